@@ -0,0 +1,209 @@
+// 关键字识别微基准
+//
+//   1. 已切好的词：原 strcmp 链 vs 生成的完美哈希表
+//   2. 从源程序中扫描标识符并判断保留字：
+//      两遍（先扫出标识符，再查完美哈希表） vs 一遍（扫描时沿关键字 trie 前进，pl0lex.c 的做法）
+//
+// 用法:
+//     gcc -O2 bench_keywords.c -o bench_keywords
+//     ./bench_keywords [词数] [轮数]
+//
+// 输入为以标识符为主的随机词表：约 20% 关键字，其余为普通标识符，
+// 其中一部分刻意与关键字同长度、同首字母或同前缀，贴近真实源程序。
+// 第 2 组把同一批词以空格分隔拼成一段文本来扫描。
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pl0_sym.h"
+#include "keyword_hash.h"
+#include "keyword_trie.h"
+
+// 优化前 lexer_manual.c 中的实现，作为对照
+int check_reserved_chain(const char *s) {
+    if (!strcmp(s, "var")) return SYM_VAR;
+    if (!strcmp(s, "if")) return SYM_IF;
+    if (!strcmp(s, "then")) return SYM_THEN;
+    if (!strcmp(s, "else")) return SYM_ELSE;
+    if (!strcmp(s, "while")) return SYM_WHILE;
+    if (!strcmp(s, "for")) return SYM_FOR;
+    if (!strcmp(s, "begin")) return SYM_BEGIN;
+    if (!strcmp(s, "writeln")) return SYM_WRITELN;
+    if (!strcmp(s, "procedure")) return SYM_PROCEDURE;
+    if (!strcmp(s, "end")) return SYM_END;
+
+    if (!strcmp(s, "const")) return SYM_CONST;
+    if (!strcmp(s, "call")) return SYM_CALL;
+    if (!strcmp(s, "do")) return SYM_DO;
+    if (!strcmp(s, "write")) return SYM_WRITE;
+    return 0;
+}
+
+const char *keywords[] = {
+    "var", "if", "then", "else", "while", "for", "begin",
+    "writeln", "procedure", "end", "const", "call", "do", "write"
+};
+#define NKEYWORDS (int)(sizeof(keywords) / sizeof(keywords[0]))
+
+typedef struct {
+    char text[16];
+    int len;
+} Word;
+
+unsigned long long rng = 88172645463325252ULL;
+
+unsigned next_rand() {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (unsigned)rng;
+}
+
+void make_word(Word *w) {
+    static const char alnum[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    unsigned r = next_rand() % 100;
+
+    if (r < 20) {
+        // 关键字
+        strcpy(w->text, keywords[next_rand() % NKEYWORDS]);
+    } else if (r < 40) {
+        // 关键字加后缀，如 end1、writelnx
+        const char *kw = keywords[next_rand() % NKEYWORDS];
+        int n = strlen(kw);
+        memcpy(w->text, kw, n);
+        w->text[n] = alnum[next_rand() % 36];
+        w->text[n + 1] = '\0';
+    } else {
+        // 普通标识符，长度 1~12
+        int n = 1 + next_rand() % 12;
+        w->text[0] = alnum[next_rand() % 52];
+        for (int i = 1; i < n; i++)
+            w->text[i] = alnum[next_rand() % 62];
+        w->text[n] = '\0';
+    }
+    w->len = strlen(w->text);
+}
+
+// 标识符字符表
+unsigned char is_alnum[256];
+
+// 两遍：先找出标识符的末尾，再查表
+const char *scan_two_pass(const char *p, int *sym) {
+    const char *start = p;
+    while (is_alnum[(unsigned char)*p]) p++;
+    *sym = keyword_lookup(start, p - start);
+    return p;
+}
+
+// 一遍：扫描的同时走 trie，扫完即得结果
+const char *scan_trie(const char *p, int *sym) {
+    unsigned kw = KW_TRIE_ROOT;
+    while (is_alnum[(unsigned char)*p]) kw = kw_trie[kw][(unsigned char)*p++];
+    *sym = kw_accept[kw];
+    return p;
+}
+
+double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    int nwords = argc > 1 ? atoi(argv[1]) : 100000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 100;
+    if (nwords <= 0 || rounds <= 0) {
+        fprintf(stderr, "usage: %s [words] [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    Word *words = malloc(sizeof(Word) * nwords);
+    if (!words) return 1;
+    for (int i = 0; i < nwords; i++) make_word(&words[i]);
+
+    // 两种实现必须给出完全相同的结果
+    int nkw = 0;
+    for (int i = 0; i < nwords; i++) {
+        int a = check_reserved_chain(words[i].text);
+        int b = keyword_lookup(words[i].text, words[i].len);
+        if (a != b) {
+            fprintf(stderr, "mismatch on \"%s\": chain=%d hash=%d\n", words[i].text, a, b);
+            return 1;
+        }
+        if (a) nkw++;
+    }
+
+    // 拼成以空格分隔的文本，末尾 '\0'
+    for (int c = 0; c < 256; c++)
+        is_alnum[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+    size_t text_len = 0;
+    for (int i = 0; i < nwords; i++) text_len += words[i].len + 1;
+    char *text = malloc(text_len + 1);
+    if (!text) return 1;
+    char *q = text;
+    for (int i = 0; i < nwords; i++) {
+        memcpy(q, words[i].text, words[i].len);
+        q += words[i].len;
+        *q++ = ' ';
+    }
+    *q = '\0';
+
+    // 扫描的两种做法也必须逐词一致
+    const char *pa = text, *pb = text;
+    for (int i = 0; i < nwords; i++) {
+        int a, b;
+        pa = scan_two_pass(pa, &a) + 1;
+        pb = scan_trie(pb, &b) + 1;
+        if (a != b || pa != pb) {
+            fprintf(stderr, "mismatch on \"%s\": two-pass=%d trie=%d\n", words[i].text, a, b);
+            return 1;
+        }
+    }
+
+    long long sum_chain = 0, sum_hash = 0, sum_two = 0, sum_trie = 0;
+
+    double t0 = now_sec();
+    for (int r = 0; r < rounds; r++)
+        for (int i = 0; i < nwords; i++)
+            sum_chain += check_reserved_chain(words[i].text);
+    double t_chain = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int r = 0; r < rounds; r++)
+        for (int i = 0; i < nwords; i++)
+            sum_hash += keyword_lookup(words[i].text, words[i].len);
+    double t_hash = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int r = 0; r < rounds; r++)
+        for (const char *p = text; *p; p++) {
+            int sym;
+            p = scan_two_pass(p, &sym);
+            sum_two += sym;
+        }
+    double t_two = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int r = 0; r < rounds; r++)
+        for (const char *p = text; *p; p++) {
+            int sym;
+            p = scan_trie(p, &sym);
+            sum_trie += sym;
+        }
+    double t_trie = now_sec() - t0;
+
+    double total = (double)nwords * rounds;
+    printf("words: %d (keywords %d), rounds: %d\n", nwords, nkw, rounds);
+    printf("strcmp chain : %8.2f ns/lookup  (checksum %lld)\n", t_chain * 1e9 / total, sum_chain);
+    printf("perfect hash : %8.2f ns/lookup  (checksum %lld)\n", t_hash * 1e9 / total, sum_hash);
+    printf("speedup      : %8.2fx\n", t_chain / t_hash);
+    printf("scan + hash  : %8.2f ns/word    (checksum %lld)\n", t_two * 1e9 / total, sum_two);
+    printf("scan + trie  : %8.2f ns/word    (checksum %lld)\n", t_trie * 1e9 / total, sum_trie);
+    printf("speedup      : %8.2fx\n", t_two / t_trie);
+
+    free(text);
+    free(words);
+    return 0;
+}
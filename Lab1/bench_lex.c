@@ -0,0 +1,263 @@
+// 词法分析吞吐量基准：手写 DFA 分析器（pl0lex.c）vs flex 扫描器（pl0_lexer.l、pl0_lexer_r.l）
+//
+// 用法:
+//     gcc -O2 -pthread -DPL0_LEXER_NO_MAIN bench_lex.c corpus.c pl0lex.c lex_simd.c intern.c tokwriter.c lex.yy.c pl0_lexer_r.c -o bench_lex
+//     ./bench_lex [-n MB] [-m 配比] [-r 轮数] [-s 种子] [-o 文件]
+//
+//     -n 每种语料的大小，单位 MB，默认 16
+//     -m 只测一种配比：mixed / ident / comment / string / error / utf8（见 corpus.h），默认全测
+//     -r 每项重复的次数，取最快的一次，默认 5
+//     -s 随机种子，默认 1；种子相同，语料逐字节相同
+//     -o 只把语料写到文件（配合 -m 选择配比），不跑基准
+//
+// 语料在内存中生成，不经过文件系统。每种语料测以下几项：
+//     manual        pl0_lex_batch 取出全部 token，不输出
+//     manual+text   同上，再经 tokwriter 格式化成文本写到 /dev/null
+//     flex+text     yylex，动作中经同一个 tokwriter 写到 /dev/null
+//     flex-r+text   可重入、满表的 flex 扫描器，其余同上
+//     utf8-check    只做 UTF-8 校验（pl0_utf8_check），不分析
+//     manual+utf8   打开 UTF-8 模式（先校验）后同 manual
+// flex+text 与 manual+text 同两个命令行程序做的事相同，可以直接比较。
+// 周期数在 x86 上用 TSC 计，频率可变的 CPU 上只作参考；其他平台不报。
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include "corpus.h"
+#include "pl0lex.h"
+#include "tokwriter.h"
+
+#define BATCH_SIZE 256
+
+// lex.yy.c 中的扫描器与它的输出
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+YY_BUFFER_STATE yy_scan_buffer(char *base, size_t size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+int yylex(void);
+extern tokwriter tw_out;
+// pl0_lexer_r.c
+int pl0r_scan_mem(char *buf, size_t len, tokwriter *tw);
+
+// 测试项
+enum {
+    T_MANUAL,
+    T_MANUAL_TEXT,
+    T_FLEX_TEXT,
+    T_FLEX_R_TEXT,
+    T_UTF8_CHECK,       // 只校验，不产生 token
+    T_MANUAL_UTF8,
+    T_COUNT
+};
+
+static const char *const names[T_COUNT] = {
+    [T_MANUAL]      = "manual",
+    [T_MANUAL_TEXT] = "manual+text",
+    [T_FLEX_TEXT]   = "flex+text",
+    [T_FLEX_R_TEXT] = "flex-r+text",
+    [T_UTF8_CHECK]  = "utf8-check",
+    [T_MANUAL_UTF8] = "manual+utf8",
+};
+
+typedef struct {
+    double sec;
+    unsigned long long cycles;
+    size_t ntokens;
+} Result;
+
+int devnull = -1;
+
+double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+unsigned long long now_cycles() {
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// 手写分析器；text 非 0 时把 token 格式化输出到 /dev/null，utf8 非 0 时打开 UTF-8 模式
+size_t run_manual(const char *src, size_t len, int text, int utf8) {
+    pl0_lexer *lx = pl0_lexer_open_mem(src, len);
+    tokwriter tw;
+    if (!lx || (text && tw_init(&tw, devnull) != 0)) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    if (utf8 && pl0_lexer_set_utf8(lx, 1) != 0) {
+        fprintf(stderr, "Invalid UTF-8 in corpus\n");
+        exit(1);
+    }
+
+    pl0_token toks[BATCH_SIZE];
+    size_t n, total = 0;
+    while ((n = pl0_lex_batch(lx, toks, BATCH_SIZE)) > 0) {
+        total += n;
+        if (text)
+            for (size_t i = 0; i < n; i++)
+                tw_token(&tw, toks[i].sym, toks[i].text, toks[i].len);
+    }
+    pl0_lexer_close(lx);
+    if (text) tw_close(&tw);
+    return total;
+}
+
+// flex 扫描器：yy_scan_buffer 就地扫描，要求末尾有两个 '\0'。
+// 扫描过程中会改写缓冲区，每次都要用语料的新拷贝
+size_t run_flex(char *src, size_t len) {
+    if (tw_init(&tw_out, devnull) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    YY_BUFFER_STATE b = yy_scan_buffer(src, len + 2);
+    yylex();
+    yy_delete_buffer(b);
+    size_t n = tw_out.ntokens;
+    tw_close(&tw_out);
+    return n;
+}
+
+// 可重入 flex 扫描器，缓冲区的要求同上
+size_t run_flex_r(char *src, size_t len) {
+    tokwriter tw;
+    if (tw_init(&tw, devnull) != 0 || pl0r_scan_mem(src, len, &tw) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    size_t n = tw.ntokens;
+    tw_close(&tw);
+    return n;
+}
+
+// 重复 rounds 次，取最快的一次
+Result measure(int which, char *src, char *flex_src, size_t len, int rounds) {
+    Result best = { 0, 0, 0 };
+    for (int r = 0; r < rounds; r++) {
+        Result cur;
+        if (which == T_FLEX_TEXT || which == T_FLEX_R_TEXT) memcpy(flex_src, src, len + 2);
+        double t0 = now_sec();
+        unsigned long long c0 = now_cycles();
+        switch (which) {
+            case T_FLEX_TEXT:
+                cur.ntokens = run_flex(flex_src, len);
+                break;
+            case T_FLEX_R_TEXT:
+                cur.ntokens = run_flex_r(flex_src, len);
+                break;
+            case T_UTF8_CHECK:
+                pl0_utf8_check(src, len);
+                cur.ntokens = 0;
+                break;
+            default:
+                cur.ntokens = run_manual(src, len, which == T_MANUAL_TEXT, which == T_MANUAL_UTF8);
+                break;
+        }
+        cur.cycles = now_cycles() - c0;
+        cur.sec = now_sec() - t0;
+        if (r == 0 || cur.sec < best.sec) best = cur;
+    }
+    return best;
+}
+
+void bench_mix(corpus_mix mix, size_t size, unsigned long long seed, int rounds) {
+    size_t len;
+    char *src = corpus_generate(mix, size, seed, &len);
+    char *flex_src = src ? malloc(len + 2) : NULL;
+    if (!flex_src) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    if (pl0_utf8_check(src, len) != len) {
+        fprintf(stderr, "Invalid UTF-8 in corpus\n");
+        exit(1);
+    }
+
+    printf("corpus: %-8s %.2f MB  seed %llu\n", corpus_mix_name(mix), len / 1e6, seed);
+    printf("    %-12s %10s %10s %10s %10s\n", "lexer", "tokens", "MB/s", "Mtok/s", "cycles/B");
+    for (int which = 0; which < T_COUNT; which++) {
+        Result res = measure(which, src, flex_src, len, rounds);
+        if (which == T_UTF8_CHECK)
+            printf("    %-12s %10s %10.1f %10s", names[which], "-", len / res.sec / 1e6, "-");
+        else
+            printf("    %-12s %10zu %10.1f %10.1f", names[which], res.ntokens,
+                   len / res.sec / 1e6, res.ntokens / res.sec / 1e6);
+#ifdef HAVE_TSC
+        printf(" %10.2f\n", (double)res.cycles / len);
+#else
+        printf(" %10s\n", "-");
+#endif
+    }
+    printf("\n");
+    free(src);
+    free(flex_src);
+}
+
+int main(int argc, char *argv[]) {
+    double mb = 16;
+    int only = -1;
+    int rounds = 5;
+    unsigned long long seed = 1;
+    const char *out = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            mb = atof(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            only = corpus_mix_from_name(argv[++i]);
+            if (only < 0) {
+                fprintf(stderr, "unknown mix: %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+            rounds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-n MB] [-m mix] [-r rounds] [-s seed] [-o file]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (mb <= 0 || rounds <= 0) {
+        fprintf(stderr, "bad size or rounds\n");
+        return 1;
+    }
+    size_t size = (size_t)(mb * 1e6);
+
+    // 只生成语料
+    if (out) {
+        size_t len;
+        char *src = corpus_generate(only < 0 ? CORPUS_MIXED : only, size, seed, &len);
+        FILE *fp = fopen(out, "wb");
+        if (!src || !fp || fwrite(src, 1, len, fp) != len || fclose(fp) != 0) {
+            fprintf(stderr, "Cannot write corpus: %s\n", out);
+            return 1;
+        }
+        free(src);
+        return 0;
+    }
+
+    devnull = open("/dev/null", O_WRONLY);
+    if (devnull < 0) {
+        fprintf(stderr, "Cannot open /dev/null\n");
+        return 1;
+    }
+    for (int mix = 0; mix < CORPUS_NMIX; mix++)
+        if (only < 0 || only == mix) bench_mix(mix, size, seed, rounds);
+    close(devnull);
+    return 0;
+}
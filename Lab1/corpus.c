@@ -0,0 +1,375 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "corpus.h"
+
+// 语句种类
+enum {
+    ST_ASSIGN,      // a := 表达式;
+    ST_IF,          // if 条件 then 语句
+    ST_WHILE,       // while 条件 do begin ... end;
+    ST_CALL,        // call p;
+    ST_WRITE,       // write("..."); / writeln "..." / write(表达式);
+    ST_DECL,        // var / const / procedure
+    ST_COMMENT,     // { ... }
+    ST_ERROR,       // 各类词法错误
+    ST_COUNT
+};
+
+// 各配比下每种语句的权重
+static const unsigned mix_weight[CORPUS_NMIX][ST_COUNT] = {
+    //                 ASSIGN IF WHILE CALL WRITE DECL COMMENT ERROR
+    [CORPUS_MIXED]   = { 40,  12,  6,   4,   8,    6,   5,      0 },
+    [CORPUS_IDENT]   = { 70,   8,  4,   8,   0,   10,   0,      0 },
+    [CORPUS_COMMENT] = { 15,   3,  2,   0,   2,    2,  76,      0 },
+    [CORPUS_STRING]  = { 15,   3,  2,   0,  78,    2,   0,      0 },
+    [CORPUS_ERROR]   = { 30,   5,  2,   2,   5,    3,   3,     50 },
+    [CORPUS_UTF8]    = { 40,  10,  5,   4,  20,    6,  15,      0 },
+};
+
+static const char *const mix_names[CORPUS_NMIX] = {
+    [CORPUS_MIXED]   = "mixed",
+    [CORPUS_IDENT]   = "ident",
+    [CORPUS_COMMENT] = "comment",
+    [CORPUS_STRING]  = "string",
+    [CORPUS_ERROR]   = "error",
+    [CORPUS_UTF8]    = "utf8",
+};
+
+typedef struct {
+    char *buf;
+    size_t len, cap;
+    uint64_t rng;
+    corpus_mix mix;
+    int depth;              // 缩进层数
+    int oom;
+} gen;
+
+int corpus_mix_from_name(const char *name) {
+    for (int i = 0; i < CORPUS_NMIX; i++)
+        if (strcmp(name, mix_names[i]) == 0) return i;
+    return -1;
+}
+
+const char *corpus_mix_name(corpus_mix mix) {
+    return mix_names[mix];
+}
+
+//=========================
+//     输出
+//=========================
+// xorshift64，种子相同则序列相同
+static uint32_t next_rand(gen *g) {
+    g->rng ^= g->rng << 13;
+    g->rng ^= g->rng >> 7;
+    g->rng ^= g->rng << 17;
+    return (uint32_t)(g->rng >> 32);
+}
+
+// [lo, hi] 中的随机数
+static unsigned range(gen *g, unsigned lo, unsigned hi) {
+    return lo + next_rand(g) % (hi - lo + 1);
+}
+
+static void put(gen *g, const char *s, size_t n) {
+    if (g->len + n + 2 > g->cap) {
+        size_t cap = g->cap * 2;
+        while (cap < g->len + n + 2) cap *= 2;
+        char *p = g->oom ? NULL : realloc(g->buf, cap);
+        if (!p) {
+            g->oom = 1;
+            return;
+        }
+        g->buf = p;
+        g->cap = cap;
+    }
+    memcpy(g->buf + g->len, s, n);
+    g->len += n;
+}
+
+static void put_str(gen *g, const char *s) {
+    put(g, s, strlen(s));
+}
+
+static void put_ch(gen *g, char c) {
+    put(g, &c, 1);
+}
+
+static void put_indent(gen *g) {
+    for (int i = 0; i < g->depth; i++) put(g, "    ", 4);
+}
+
+//=========================
+//     词法单元
+//=========================
+static void put_ident(gen *g) {
+    static const char first[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    static const char rest[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    // 标识符为主的语料用长名字（类似生成代码中的 tmpcounter17），其余以短名字为主
+    unsigned n = g->mix == CORPUS_IDENT ? range(g, 8, 32) : range(g, 1, 10);
+    char s[32];
+    s[0] = first[next_rand(g) % (sizeof(first) - 1)];
+    for (unsigned i = 1; i < n; i++) s[i] = rest[next_rand(g) % (sizeof(rest) - 1)];
+    put(g, s, n);
+}
+
+static void put_number(gen *g) {
+    char s[16];
+    unsigned n = range(g, 1, 6);
+    s[0] = '1' + next_rand(g) % 9;
+    for (unsigned i = 1; i < n; i++) s[i] = '0' + next_rand(g) % 10;
+    put(g, s, n);
+}
+
+// 可见 ASCII 文本，不含 stop 中的字符；utf8 配比下约三成换成多字节字符，n 仍按字符计
+static void put_text(gen *g, unsigned n, const char *stop) {
+    static const char words[] = "abcdefghijklmnopqrstuvwxyz   ABCDEFG0123456789,.;:!?-+*/()=<>'";
+    static const char *const wide[] = { "中", "文", "注", "释", "变", "量", "é", "ü", "ß", "→", "≤", "😀" };
+    for (unsigned i = 0; i < n; i++) {
+        if (g->mix == CORPUS_UTF8 && next_rand(g) % 10 < 3) {
+            put_str(g, wide[next_rand(g) % (sizeof(wide) / sizeof(wide[0]))]);
+            continue;
+        }
+        char c = words[next_rand(g) % (sizeof(words) - 1)];
+        if (strchr(stop, c)) c = ' ';
+        put_ch(g, c);
+    }
+}
+
+static void put_string(gen *g) {
+    unsigned n = g->mix == CORPUS_STRING ? range(g, 20, 200) : range(g, 0, 20);
+    put_ch(g, '"');
+    put_text(g, n, "\"");
+    put_ch(g, '"');
+}
+
+static void put_comment(gen *g) {
+    unsigned n = g->mix == CORPUS_COMMENT ? range(g, 40, 160) : range(g, 4, 30);
+    put_str(g, "{ ");
+    put_text(g, n, "}");
+    put_str(g, " }");
+}
+
+//=========================
+//     表达式与语句
+//=========================
+static void put_expr(gen *g, int depth);
+
+static void put_factor(gen *g, int depth) {
+    unsigned r = next_rand(g) % 10;
+    if (r < 6) {
+        put_ident(g);
+    } else if (r < 9 || depth >= 3) {
+        put_number(g);
+    } else {
+        put_ch(g, '(');
+        put_expr(g, depth + 1);
+        put_ch(g, ')');
+    }
+}
+
+static void put_term(gen *g, int depth) {
+    put_factor(g, depth);
+    while (next_rand(g) % 4 == 0) {
+        put_str(g, next_rand(g) % 2 ? " * " : " / ");
+        put_factor(g, depth);
+    }
+}
+
+static void put_expr(gen *g, int depth) {
+    if (next_rand(g) % 8 == 0) put_ch(g, '-');
+    put_term(g, depth);
+    while (next_rand(g) % 3 == 0) {
+        put_str(g, next_rand(g) % 2 ? " + " : " - ");
+        put_term(g, depth);
+    }
+}
+
+static void put_cond(gen *g) {
+    static const char *const relops[] = { " = ", " <> ", " < ", " <= ", " > ", " >= " };
+    put_expr(g, 0);
+    put_str(g, relops[next_rand(g) % 6]);
+    put_expr(g, 0);
+}
+
+static int pick_stmt(gen *g) {
+    const unsigned *w = mix_weight[g->mix];
+    unsigned total = 0;
+    for (int i = 0; i < ST_COUNT; i++) total += w[i];
+    unsigned r = next_rand(g) % total;
+    int k = 0;
+    while (r >= w[k]) r -= w[k++];
+    return k;
+}
+
+static void put_stmt(gen *g);
+
+// 词法错误，每行一处
+static void put_error(gen *g) {
+    static const char illegal[] = "@#$?!~&|^%`\\";
+    switch (next_rand(g) % 6) {
+        case 0:         // 数字后接字母
+            put_ident(g);
+            put_str(g, " := ");
+            put_number(g);
+            put_ident(g);
+            put_str(g, ";\n");
+            break;
+        case 1:         // 非法字符
+            put_ident(g);
+            put_str(g, " := ");
+            put_ident(g);
+            put_ch(g, ' ');
+            put_ch(g, illegal[next_rand(g) % (sizeof(illegal) - 1)]);
+            put_ch(g, ' ');
+            put_ident(g);
+            put_str(g, ";\n");
+            break;
+        case 2:         // 未闭合的注释，到行尾为止
+            put_str(g, "{ ");
+            put_text(g, range(g, 4, 30), "}");
+            put_ch(g, '\n');
+            break;
+        case 3:         // 未闭合的字符串
+            put_str(g, "write(\"");
+            put_text(g, range(g, 4, 30), "\"");
+            put_ch(g, '\n');
+            break;
+        case 4:         // 单独的 ':'
+            put_ident(g);
+            put_str(g, " : ");
+            put_expr(g, 0);
+            put_str(g, ";\n");
+            break;
+        default:        // 单独的 '}'
+            put_str(g, "} ");
+            put_ident(g);
+            put_str(g, ";\n");
+            break;
+    }
+}
+
+static void put_block(gen *g) {
+    put_indent(g);
+    put_str(g, "begin\n");
+    g->depth++;
+    for (unsigned n = range(g, 1, 4); n > 0; n--) put_stmt(g);
+    g->depth--;
+    put_indent(g);
+    put_str(g, "end;\n");
+}
+
+static void put_stmt(gen *g) {
+    int kind = pick_stmt(g);
+    // 控制嵌套深度，过深时改为简单语句
+    if (g->depth >= 4 && (kind == ST_IF || kind == ST_WHILE || kind == ST_DECL)) kind = ST_ASSIGN;
+
+    put_indent(g);
+    switch (kind) {
+        case ST_ASSIGN:
+            put_ident(g);
+            put_str(g, " := ");
+            put_expr(g, 0);
+            put_str(g, ";\n");
+            break;
+        case ST_IF:
+            put_str(g, "if ");
+            put_cond(g);
+            put_str(g, " then\n");
+            g->depth++;
+            put_stmt(g);
+            g->depth--;
+            if (next_rand(g) % 3 == 0) {
+                put_indent(g);
+                put_str(g, "else\n");
+                g->depth++;
+                put_stmt(g);
+                g->depth--;
+            }
+            break;
+        case ST_WHILE:
+            put_str(g, "while ");
+            put_cond(g);
+            put_str(g, " do\n");
+            put_block(g);
+            break;
+        case ST_CALL:
+            put_str(g, "call ");
+            put_ident(g);
+            put_str(g, ";\n");
+            break;
+        case ST_WRITE:
+            switch (next_rand(g) % 3) {
+                case 0:
+                    put_str(g, "write(");
+                    put_string(g);
+                    put_str(g, ");\n");
+                    break;
+                case 1:
+                    put_str(g, "writeln ");
+                    put_string(g);
+                    put_ch(g, '\n');
+                    break;
+                default:
+                    put_str(g, "write(");
+                    put_expr(g, 0);
+                    put_str(g, ");\n");
+                    break;
+            }
+            break;
+        case ST_DECL:
+            switch (next_rand(g) % 3) {
+                case 0:
+                    put_str(g, "var ");
+                    put_ident(g);
+                    for (unsigned n = range(g, 0, 5); n > 0; n--) {
+                        put_str(g, ", ");
+                        put_ident(g);
+                    }
+                    put_str(g, ";\n");
+                    break;
+                case 1:
+                    put_str(g, "const ");
+                    put_ident(g);
+                    put_str(g, " = ");
+                    put_number(g);
+                    put_str(g, ";\n");
+                    break;
+                default:
+                    put_str(g, "procedure ");
+                    put_ident(g);
+                    put_str(g, ";\n");
+                    put_block(g);
+                    break;
+            }
+            break;
+        case ST_COMMENT:
+            put_comment(g);
+            put_ch(g, '\n');
+            break;
+        default:
+            put_error(g);
+            break;
+    }
+}
+
+char *corpus_generate(corpus_mix mix, size_t size, uint64_t seed, size_t *len) {
+    gen g;
+    memset(&g, 0, sizeof(g));
+    g.mix = mix;
+    g.rng = seed ? seed : 88172645463325252ULL;     // xorshift 的状态不能为 0
+    g.cap = size + 4096;
+    g.buf = malloc(g.cap);
+    if (!g.buf) return NULL;
+
+    while (g.len < size && !g.oom) put_stmt(&g);
+    if (g.oom) {
+        free(g.buf);
+        return NULL;
+    }
+    // put 保证末尾留有两个字节
+    g.buf[g.len] = '\0';
+    g.buf[g.len + 1] = '\0';
+    *len = g.len;
+    return g.buf;
+}
@@ -0,0 +1,38 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+// 合成 PL/0 语料生成器，供词法分析基准使用
+//
+// 按语句随机拼出源程序，种子相同则输出逐字节相同。
+// 不同的配比侧重不同的扫描路径：
+//     mixed    接近手写程序：声明、赋值、条件、循环、输出，少量注释和字符串
+//     ident    长标识符为主的赋值与表达式
+//     comment  大段注释
+//     string   带长字符串的 write / writeln
+//     error    非法字符、数字后接字母、未闭合的注释和字符串、单独的 ':'
+//     utf8     同 mixed，但注释和字符串更多，其中夹带中文等多字节 UTF-8 文本
+// 语料是合法的 UTF-8（除 utf8 外只含 ASCII），不含 NUL，以换行结尾。
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    CORPUS_MIXED,
+    CORPUS_IDENT,
+    CORPUS_COMMENT,
+    CORPUS_STRING,
+    CORPUS_ERROR,
+    CORPUS_UTF8,
+    CORPUS_NMIX
+} corpus_mix;
+
+// 配比名（如 "ident"），不认识的名字返回 -1
+int corpus_mix_from_name(const char *name);
+const char *corpus_mix_name(corpus_mix mix);
+
+// 生成约 size 字节的语料（在 size 之后的第一个行尾截止），*len 为实际长度。
+// 返回的缓冲区末尾另有两个 '\0'，可直接交给 pl0_lexer_open_mem 或 flex 的 yy_scan_buffer。
+// 由调用方 free；内存不足返回 NULL
+char *corpus_generate(corpus_mix mix, size_t size, uint64_t seed, size_t *len);
+
+#endif
@@ -0,0 +1,248 @@
+// 关键字查找表生成器
+//
+// 从 pl0_sym.h 中读取形如
+//     SYM_VAR = 21,            // var
+// 的枚举项（注释为纯小写单词的即视为关键字），输出两种查找表之一：
+//   - 完美哈希：搜索一组使所有关键字互不冲突的哈希参数，输出 keyword_hash.h（bench_keywords 对照用）
+//   - trie（-t）：关键字前缀树的状态转移表，输出 keyword_trie.h。
+//     pl0lex.c 在 STATE_INID 中边扫描标识符边走 trie，扫完即知是否为关键字
+//
+// 用法:
+//     gcc gen_keywords.c -o gen_keywords
+//     ./gen_keywords pl0_sym.h > keyword_hash.h
+//     ./gen_keywords -t pl0_sym.h > keyword_trie.h
+//
+// 修改关键字后重新生成即可，查找表永远与枚举保持一致。
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+
+#define MAX_KW      64
+#define MAX_KW_LEN  32
+
+typedef struct {
+    char sym[64];           // 枚举名，如 SYM_VAR
+    char word[MAX_KW_LEN];  // 关键字本身，如 var
+    int len;
+} Keyword;
+
+Keyword kws[MAX_KW];
+int nkw = 0;
+
+// 解析一行枚举定义，是关键字则记录下来
+void parse_line(const char *line) {
+    const char *p = line;
+    while (isspace((unsigned char)*p)) p++;
+    if (strncmp(p, "SYM_", 4) != 0) return;
+
+    Keyword kw;
+    int k = 0;
+    while ((isalnum((unsigned char)*p) || *p == '_') && k < (int)sizeof(kw.sym) - 1)
+        kw.sym[k++] = *p++;
+    kw.sym[k] = '\0';
+
+    const char *c = strstr(p, "//");
+    if (!c) return;
+    c += 2;
+    while (*c == ' ' || *c == '\t') c++;
+
+    k = 0;
+    while (islower((unsigned char)*c) && k < MAX_KW_LEN - 1)
+        kw.word[k++] = *c++;
+    kw.word[k] = '\0';
+    while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') c++;
+
+    // 注释必须恰好是一个小写单词
+    if (k == 0 || *c != '\0') return;
+    kw.len = k;
+
+    if (nkw >= MAX_KW) {
+        fprintf(stderr, "too many keywords\n");
+        exit(1);
+    }
+    kws[nkw++] = kw;
+}
+
+// 取首字符、第二个字符、末字符与长度混合；while / write 这类首尾相同的词靠第二个字符区分
+unsigned hash(const char *s, int len, unsigned a, unsigned b, unsigned c, unsigned mask) {
+    return (len + (unsigned char)s[0] * a + (unsigned char)s[1] * b + (unsigned char)s[len - 1] * c) & mask;
+}
+
+// 在给定表长下搜索无冲突参数，找到返回 1
+int search(unsigned size, unsigned *pa, unsigned *pb, unsigned *pc) {
+    unsigned char used[1024];
+    for (unsigned a = 1; a < 64; a++)
+        for (unsigned b = 0; b < 64; b++)
+            for (unsigned c = 0; c < 64; c++) {
+                memset(used, 0, size);
+                int ok = 1;
+                for (int i = 0; i < nkw && ok; i++) {
+                    unsigned h = hash(kws[i].word, kws[i].len, a, b, c, size - 1);
+                    if (used[h]) ok = 0;
+                    used[h] = 1;
+                }
+                if (ok) {
+                    *pa = a;
+                    *pb = b;
+                    *pc = c;
+                    return 1;
+                }
+            }
+    return 0;
+}
+
+//=========================
+//     trie
+//=========================
+#define MAX_TRIE 256        // 状态号存为 unsigned char
+
+typedef struct {
+    int next[26];           // 读入 'a' + i 后的状态，0 表示没有
+    const char *sym;        // 在此结束的关键字的枚举名，NULL 表示不是关键字
+    char prefix[MAX_KW_LEN];
+} TrieNode;
+
+// 0 号为死状态，1 号为根
+TrieNode trie[MAX_TRIE];
+int ntrie = 2;
+
+int gen_trie(const char *src) {
+    for (int i = 0; i < nkw; i++) {
+        int s = 1;
+        for (int j = 0; j < kws[i].len; j++) {
+            int c = kws[i].word[j] - 'a';
+            if (!trie[s].next[c]) {
+                if (ntrie >= MAX_TRIE) {
+                    fprintf(stderr, "too many trie states\n");
+                    return 1;
+                }
+                memcpy(trie[ntrie].prefix, kws[i].word, j + 1);
+                trie[s].next[c] = ntrie++;
+            }
+            s = trie[s].next[c];
+        }
+        trie[s].sym = kws[i].sym;
+    }
+
+    printf("// 由 gen_keywords.c 根据 %s 生成，请勿手工修改\n", src);
+    printf("#ifndef KEYWORD_TRIE_H\n");
+    printf("#define KEYWORD_TRIE_H\n\n");
+    printf("#define KW_COUNT       %d\n", nkw);
+    printf("#define KW_TRIE_STATES %d\n", ntrie);
+    printf("#define KW_TRIE_ROOT   1\n\n");
+
+    printf("// kw_trie[s][c]：状态 s 读入字符 c 后的状态。0 为死状态，到此不可能再是关键字，此后一直为 0。\n");
+    printf("// c 为标识符中的字符（字母、数字，都小于 128），表中只列出关键字用到的小写字母\n");
+    printf("static const unsigned char kw_trie[KW_TRIE_STATES][128] = {\n");
+    for (int s = 1; s < ntrie; s++) {
+        int any = 0;
+        char row[512];
+        int n = 0;
+        for (int c = 0; c < 26; c++) {
+            if (!trie[s].next[c]) continue;
+            n += snprintf(row + n, sizeof(row) - n, "%s['%c'] = %d", any ? ", " : "", 'a' + c, trie[s].next[c]);
+            any = 1;
+        }
+        if (!any) continue;
+        int w = printf("    [%d] = { %s },", s, row);
+        printf("%*s// \"%s\"\n", w < 56 ? 56 - w : 1, "", trie[s].prefix);
+    }
+    printf("};\n\n");
+
+    printf("// 在状态 s 处结束的标识符的种别，0 表示不是关键字\n");
+    printf("static const unsigned char kw_accept[KW_TRIE_STATES] = {\n");
+    for (int s = 1; s < ntrie; s++)
+        if (trie[s].sym) {
+            int w = printf("    [%d] = %s,", s, trie[s].sym);
+            printf("%*s// \"%s\"\n", w < 32 ? 32 - w : 1, "", trie[s].prefix);
+        }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int want_trie = argc > 2 && strcmp(argv[1], "-t") == 0;
+    if (argc < 2 || (argc > 2 && !want_trie)) {
+        fprintf(stderr, "usage: %s [-t] pl0_sym.h\n", argv[0]);
+        return 1;
+    }
+    const char *src = argv[argc - 1];
+    FILE *fp = fopen(src, "r");
+    if (!fp) {
+        fprintf(stderr, "Cannot open file: %s\n", src);
+        return 1;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) parse_line(line);
+    fclose(fp);
+
+    if (nkw == 0) {
+        fprintf(stderr, "no keywords found in %s\n", src);
+        return 1;
+    }
+    if (want_trie) return gen_trie(src);
+
+    int min_len = MAX_KW_LEN, max_len = 0;
+    for (int i = 0; i < nkw; i++) {
+        if (kws[i].len < min_len) min_len = kws[i].len;
+        if (kws[i].len > max_len) max_len = kws[i].len;
+    }
+
+    if (min_len < 2) {
+        fprintf(stderr, "keywords shorter than 2 chars are not supported\n");
+        return 1;
+    }
+
+    // 表长取不小于关键字数的最小 2 的幂，找不到参数就加倍
+    unsigned size = 1, a = 0, b = 0, c = 0;
+    while (size < (unsigned)nkw) size <<= 1;
+    while (!search(size, &a, &b, &c)) {
+        size <<= 1;
+        if (size > 1024) {
+            fprintf(stderr, "no perfect hash found\n");
+            return 1;
+        }
+    }
+
+    const Keyword *slot[1024] = {0};
+    for (int i = 0; i < nkw; i++)
+        slot[hash(kws[i].word, kws[i].len, a, b, c, size - 1)] = &kws[i];
+
+    printf("// 由 gen_keywords.c 根据 %s 生成，请勿手工修改\n", src);
+    printf("#ifndef KEYWORD_HASH_H\n");
+    printf("#define KEYWORD_HASH_H\n\n");
+    printf("#include <string.h>\n\n");
+    printf("#define KW_COUNT      %d\n", nkw);
+    printf("#define KW_MIN_LEN    %d\n", min_len);
+    printf("#define KW_MAX_LEN    %d\n", max_len);
+    printf("#define KW_TABLE_SIZE %u\n\n", size);
+
+    printf("static const struct {\n");
+    printf("    const char *name;\n");
+    printf("    int len;\n");
+    printf("    int sym;\n");
+    printf("} kw_table[KW_TABLE_SIZE] = {\n");
+    for (unsigned i = 0; i < size; i++) {
+        if (slot[i])
+            printf("    { \"%s\", %d, %s },\n", slot[i]->word, slot[i]->len, slot[i]->sym);
+        else
+            printf("    { \"\", 0, 0 },\n");
+    }
+    printf("};\n\n");
+
+    printf("// 关键字返回对应 SYM_*，否则返回 0\n");
+    printf("static inline int keyword_lookup(const char *s, int len) {\n");
+    printf("    if (len < KW_MIN_LEN || len > KW_MAX_LEN) return 0;\n");
+    printf("    unsigned h = (len + (unsigned char)s[0] * %uu + (unsigned char)s[1] * %uu\n", a, b);
+    printf("                  + (unsigned char)s[len - 1] * %uu)\n", c);
+    printf("                 & (KW_TABLE_SIZE - 1);\n");
+    printf("    if (kw_table[h].len == len && memcmp(s, kw_table[h].name, len) == 0)\n");
+    printf("        return kw_table[h].sym;\n");
+    printf("    return 0;\n");
+    printf("}\n\n");
+    printf("#endif\n");
+    return 0;
+}
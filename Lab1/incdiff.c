@@ -0,0 +1,334 @@
+// 增量词法分析（pl0inc.c）的差分测试：随机编辑后，文档各行缓存的 token
+// 与把全文重新完整分析一遍的结果逐个比较
+//
+// 用法:
+//     gcc -O2 incdiff.c pl0inc.c pl0lex.c lex_simd.c intern.c corpus.c -o incdiff
+//     ./incdiff [-n KB] [-e 次数] [-c 间隔] [-m 配比] [-s 种子] [文件]
+//
+//     -n 生成语料的大小，单位 KB，默认 64
+//     -e 编辑次数，默认 5000
+//     -c 每隔几次编辑完整比较一次，默认 1（每次都比）
+//     -m 语料配比：mixed / ident / comment / string / error / utf8（见 corpus.h），默认 mixed
+//     -s 随机种子，默认 1；种子相同，编辑序列相同
+//
+// 给出文件时以文件内容为初始文档，否则用生成的语料。每次编辑随机选一段
+// （同一行内或跨几行）替换为：空串、容易改变 token 边界的片段
+// （换行、未闭合的注释 / 字符串、:= 拆开……）、超长标识符 / 数字，或从初始文档中截取的一段。
+// 比较种别、列、长度、词素和数值，标识符 / 字符串还核对符号 ID 对应的驻留串；
+// 另外确认非法位置的编辑被拒绝且文档不变。
+// 最后报告驻留表大小（应只随不同的名字增长）和平均每次编辑的耗时。
+// 有不一致时报告第一处并以退出码 1 结束。
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "corpus.h"
+#include "pl0inc.h"
+
+#define BATCH_SIZE 256
+
+const char *src;                // 初始文档，编辑时从中截取片段
+size_t src_len;
+char *full = NULL;              // 拼出的全文
+size_t full_cap = 0;
+
+double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void out_of_memory() {
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+uint64_t rng;
+
+// xorshift64
+uint32_t next_rand() {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (uint32_t)(rng >> 32);
+}
+
+// [0, n) 中的随机数
+size_t rand_below(size_t n) {
+    return n ? (((uint64_t)next_rand() << 32) | next_rand()) % n : 0;
+}
+
+//=========================
+//     比较
+//=========================
+// 按行拼出全文，以 '\0' 结尾，返回长度
+size_t join_lines(const pl0_doc *d) {
+    size_t n = 0;
+    for (uint32_t line = 1; line <= pl0_doc_lines(d); line++) {
+        const char *text;
+        uint32_t len = pl0_doc_line_text(d, line, &text);
+        if (n + len + 2 > full_cap) {
+            size_t cap = full_cap ? full_cap : 4096;
+            while (cap < n + len + 2) cap *= 2;
+            char *p = realloc(full, cap);
+            if (!p) out_of_memory();
+            full = p;
+            full_cap = cap;
+        }
+        memcpy(full + n, text, len);
+        n += len;
+        if (line < pl0_doc_lines(d)) full[n++] = '\n';
+    }
+    if (!full && !(full = malloc(full_cap = 4096))) out_of_memory();
+    full[n] = '\0';
+    return n;
+}
+
+void print_token(const char *who, const pl0_token *t, uint32_t line) {
+    printf("    %-12s line %u col %u sym %d len %u \"%.*s\"\n", who, line, PL0_COL(t->loc), t->sym,
+           t->len, (int)(t->len < 60 ? t->len : 60), t->text);
+}
+
+// 文档与完整分析一致返回 0，否则报告第一处不同并返回 -1
+int check_doc(const pl0_doc *d, size_t edit) {
+    size_t n = join_lines(d);
+    pl0_lexer *lx = pl0_lexer_open_mem(full, n);
+    if (!lx) out_of_memory();
+
+    const intern_table *syms = pl0_doc_symbols(d);
+    uint32_t line = 1, idx = 0;
+    const pl0_token *lt;
+    uint32_t ln = pl0_doc_line(d, 1, &lt);
+    size_t total = 0, k;
+    int bad = 0;
+    pl0_token toks[BATCH_SIZE];
+
+    while (!bad && (k = pl0_lex_batch(lx, toks, BATCH_SIZE)) > 0) {
+        for (size_t i = 0; i < k && !bad; i++) {
+            const pl0_token *t = &toks[i];
+            total++;
+            // 跳到 t 所在的行；全量分析的 token 按行号出现，文档中此前各行必须恰好取完
+            while (line < PL0_LINE(t->loc) && idx == ln && line < pl0_doc_lines(d)) {
+                ln = pl0_doc_line(d, ++line, &lt);
+                idx = 0;
+            }
+            if (line != PL0_LINE(t->loc) || idx >= ln) {
+                printf("edit %zu: token counts of line %u differ\n", edit, line);
+                print_token("full", t, PL0_LINE(t->loc));
+                bad = 1;
+                break;
+            }
+            const pl0_token *u = &lt[idx++];
+            int ident = u->sym == SYM_IDENTIFIER || u->sym == SYM_STRING;
+            if (u->sym != t->sym || PL0_COL(u->loc) != PL0_COL(t->loc) || u->len != t->len ||
+                u->value != t->value || memcmp(u->text, t->text, t->len) != 0 ||
+                (ident != (u->id != 0)) ||
+                (ident && (u->id > syms->nsyms || intern_len(syms, u->id) != u->len ||
+                           memcmp(intern_str(syms, u->id), t->text, t->len) != 0))) {
+                printf("edit %zu: token %u of line %u differs\n", edit, idx, line);
+                print_token("full", t, line);
+                print_token("incremental", u, line);
+                bad = 1;
+            }
+        }
+    }
+    if (pl0_lexer_error(lx)) out_of_memory();
+    pl0_lexer_close(lx);
+
+    if (!bad && total != pl0_doc_ntokens(d)) {
+        printf("edit %zu: document has %zu tokens, full lex %zu\n", edit, pl0_doc_ntokens(d), total);
+        bad = 1;
+    }
+    return bad ? -1 : 0;
+}
+
+//=========================
+//     编辑
+//=========================
+#define FRAG(s) { s, sizeof(s) - 1 }
+const struct {
+    const char *s;
+    size_t n;
+} frags[] = {
+    FRAG("\n"), FRAG("\n\n"), FRAG("{"), FRAG("}"), FRAG("{ c }"), FRAG("\""), FRAG("\"s\""),
+    FRAG(":"), FRAG("="), FRAG(":="), FRAG("<"), FRAG(">"), FRAG(" "), FRAG(";"), FRAG("x"),
+    FRAG("begin"), FRAG("end"), FRAG("if a > b then"), FRAG("123"), FRAG("12abc"), FRAG("007"),
+    FRAG("\0"), FRAG("\xe4\xb8\xad"), FRAG("@"), FRAG("{ \"\n"), FRAG("\" }\n"),
+};
+
+// 随机生成一次编辑：范围 [*start, *end) 与替换文本 [*text, *text + *len)
+void random_edit(const pl0_doc *d, pl0_loc *start, pl0_loc *end, const char **text, size_t *len) {
+    static char tmp[4096];
+    const char *p;
+    uint32_t nlines = pl0_doc_lines(d);
+    uint32_t l0 = 1 + rand_below(nlines);
+    uint32_t l1 = l0;
+    if (next_rand() % 4 == 0) l1 += rand_below(4);
+    if (l1 > nlines) l1 = nlines;
+    uint32_t len0 = pl0_doc_line_text(d, l0, &p);
+    uint32_t len1 = pl0_doc_line_text(d, l1, &p);
+    uint32_t c0 = 1 + rand_below(len0 + 1);
+    uint32_t c1 = 1 + rand_below(len1 + 1);
+    if (l0 == l1) {
+        if (c1 < c0) {
+            uint32_t c = c0;
+            c0 = c1;
+            c1 = c;
+        }
+        if (c1 - c0 > 20) c1 = c0 + rand_below(21);    // 同一行内多是小改动
+    }
+    *start = PL0_LOC(l0, c0);
+    *end = PL0_LOC(l1, c1);
+
+    unsigned r = next_rand() % 100;
+    if (r < 20) {
+        *text = "";
+        *len = 0;
+    } else if (r < 70) {
+        size_t k = rand_below(sizeof(frags) / sizeof(frags[0]));
+        *text = frags[k].s;
+        *len = frags[k].n;
+    } else if (r < 80) {
+        size_t n = 40 + rand_below(200);
+        memset(tmp, next_rand() % 2 ? 'a' : '7', n);
+        *text = tmp;
+        *len = n;
+    } else {
+        size_t n = rand_below(200);
+        if (n > src_len) n = src_len;
+        *text = src + rand_below(src_len - n + 1);
+        *len = n;
+    }
+}
+
+//=========================
+//     主程序
+//=========================
+char *read_file(const char *path, size_t *len) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "Cannot open file: %s\n", path);
+        return NULL;
+    }
+    size_t cap = 4096, n = 0, k;
+    char *buf = malloc(cap);
+    if (!buf) out_of_memory();
+    while ((k = fread(buf + n, 1, cap - n - 1, fp)) > 0) {
+        n += k;
+        if (cap - n < 4096) {
+            char *p = realloc(buf, cap *= 2);
+            if (!p) out_of_memory();
+            buf = p;
+        }
+    }
+    fclose(fp);
+    buf[n] = '\0';
+    *len = n;
+    return buf;
+}
+
+int main(int argc, char *argv[]) {
+    double kb = 64;
+    size_t nedits = 5000, every = 1;
+    int mix = CORPUS_MIXED;
+    unsigned long long seed = 1;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            kb = atof(argv[++i]);
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            nedits = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            every = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            mix = corpus_mix_from_name(argv[++i]);
+            if (mix < 0) {
+                fprintf(stderr, "unknown mix: %s\n", argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (argv[i][0] == '-' || path) {
+            fprintf(stderr, "usage: %s [-n KB] [-e edits] [-c every] [-m mix] [-s seed] [file]\n", argv[0]);
+            return 2;
+        } else
+            path = argv[i];
+    }
+
+    char *buf = path ? read_file(path, &src_len)
+                     : corpus_generate(mix, (size_t)(kb * 1000), seed, &src_len);
+    if (!buf) {
+        if (!path) out_of_memory();
+        return 2;
+    }
+    src = buf;
+    rng = seed ? seed : 88172645463325252ULL;
+
+    double t0 = now_sec();
+    pl0_doc *d = pl0_doc_open(src, src_len);
+    if (!d) out_of_memory();
+    double open_sec = now_sec() - t0;
+    if (check_doc(d, 0) != 0) return 1;
+
+    double edit_sec = 0;
+    size_t checks = 1;
+    for (size_t e = 1; e <= nedits; e++) {
+        pl0_loc start, end;
+        const char *text;
+        size_t len;
+        random_edit(d, &start, &end, &text, &len);
+
+        t0 = now_sec();
+        if (pl0_doc_edit(d, start, end, text, len) != 0) out_of_memory();
+        edit_sec += now_sec() - t0;
+
+        if (every && e % every == 0) {
+            if (check_doc(d, e) != 0) return 1;
+            checks++;
+        }
+    }
+
+    // 非法位置：末行之后、列超出行尾、start 在 end 之后，都应被拒绝且文档不变
+    uint32_t nlines = pl0_doc_lines(d);
+    const char *text;
+    uint32_t len1 = pl0_doc_line_text(d, 1, &text);
+    size_t ntokens = pl0_doc_ntokens(d);
+    if (pl0_doc_edit(d, PL0_LOC(1, 1), PL0_LOC(nlines + 1, 1), "", 0) == 0 ||
+        pl0_doc_edit(d, PL0_LOC(1, len1 + 2), PL0_LOC(1, len1 + 2), "x", 1) == 0 ||
+        pl0_doc_edit(d, PL0_LOC(nlines, 1), PL0_LOC(1, 1), "", 0) == 0 ||
+        pl0_doc_lines(d) != nlines || pl0_doc_ntokens(d) != ntokens) {
+        printf("an edit at an invalid position was accepted\n");
+        return 1;
+    }
+    if (check_doc(d, nedits) != 0) return 1;
+    checks++;
+
+    // 完整分析一遍最终文本，得到其中不同名字的个数，与文档的驻留表比较
+    size_t n = join_lines(d);
+    intern_table ref;
+    pl0_lexer *lx = pl0_lexer_open_mem(full, n);
+    if (!lx || intern_init(&ref) != 0) out_of_memory();
+    pl0_lexer_set_intern(lx, &ref);
+    pl0_token toks[BATCH_SIZE];
+    t0 = now_sec();
+    while (pl0_lex_batch(lx, toks, BATCH_SIZE) > 0)
+        ;
+    double full_sec = now_sec() - t0;
+    pl0_lexer_close(lx);
+
+    printf("%zu edits, %zu full comparisons: ok\n", nedits, checks);
+    printf("document  %u lines, %zu tokens, %zu bytes\n", pl0_doc_lines(d), pl0_doc_ntokens(d), n);
+    printf("symbols   %u in the document table, %u distinct in the final text\n",
+           pl0_doc_symbols(d)->nsyms, ref.nsyms);
+    printf("time      open %.2f ms, full re-lex %.2f ms, edit %.2f us on average\n", open_sec * 1e3,
+           full_sec * 1e3, nedits ? edit_sec / nedits * 1e6 : 0.0);
+
+    intern_free(&ref);
+    pl0_doc_close(d);
+    free(full);
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "intern.h"
+
+#define INIT_SLOTS  1024
+#define CHUNK_SIZE  (64 * 1024)     // arena 每块大小
+
+struct intern_chunk {
+    intern_chunk *next;
+    size_t used, cap;
+    char data[];
+};
+
+int intern_init(intern_table *t) {
+    memset(t, 0, sizeof(*t));
+    t->slots = calloc(INIT_SLOTS, sizeof(intern_slot));
+    if (!t->slots) return -1;
+    t->nslots = INIT_SLOTS;
+    return 0;
+}
+
+void intern_free(intern_table *t) {
+    intern_chunk *c = t->chunks;
+    while (c) {
+        intern_chunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    free(t->slots);
+    free(t->syms);
+    memset(t, 0, sizeof(*t));
+}
+
+// 8 字节一组乘法混合，最后做一次完整的 64 位混合（乘法结果的低位
+// 只取决于输入的低位，不混合的话标识符末尾几个字符影响不到桶号）。
+// 标识符通常不足 16 字节，一两轮即可
+static inline uint32_t hash_bytes(const char *s, uint32_t len) {
+    uint64_t h = (uint64_t)len * 0x9e3779b97f4a7c15ull;
+    uint32_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, s + i, 8);
+        h = (h ^ w) * 0xff51afd7ed558ccdull;
+        h ^= h >> 32;
+    }
+    uint64_t w = 0;
+    for (int sh = 0; i < len; i++, sh += 8)
+        w |= (uint64_t)(unsigned char)s[i] << sh;
+    h ^= w;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return (uint32_t)h;
+}
+
+// 从 arena 中分配 n 字节
+static char *arena_alloc(intern_table *t, size_t n) {
+    intern_chunk *c = t->chunks;
+    if (!c || c->cap - c->used < n) {
+        size_t cap = n > CHUNK_SIZE ? n : CHUNK_SIZE;
+        c = malloc(sizeof(intern_chunk) + cap);
+        if (!c) return NULL;
+        c->next = t->chunks;
+        c->used = 0;
+        c->cap = cap;
+        t->chunks = c;
+    }
+    char *p = c->data + c->used;
+    c->used += n;
+    t->arena_bytes += n;
+    return p;
+}
+
+// 桶数翻倍，按保存的哈希值重新放置，不需要重新计算哈希
+static int grow_slots(intern_table *t) {
+    uint32_t n = t->nslots * 2;
+    intern_slot *slots = calloc(n, sizeof(intern_slot));
+    if (!slots) return -1;
+    for (uint32_t i = 0; i < t->nslots; i++) {
+        if (!t->slots[i].id) continue;
+        uint32_t j = t->slots[i].hash & (n - 1);
+        while (slots[j].id) j = (j + 1) & (n - 1);
+        slots[j] = t->slots[i];
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->nslots = n;
+    return 0;
+}
+
+uint32_t intern(intern_table *t, const char *s, uint32_t len) {
+    // 保持装载因子不超过 1/2；扩容失败时只要还有空桶就继续使用旧表
+    if ((t->nsyms + 1) * 2 > t->nslots && grow_slots(t) != 0 && t->nsyms + 1 >= t->nslots)
+        return 0;
+
+    uint32_t h = hash_bytes(s, len);
+    uint32_t mask = t->nslots - 1;
+    uint32_t i = h & mask;
+
+    t->lookups++;
+    for (;;) {
+        t->probes++;
+        intern_slot *sl = &t->slots[i];
+        if (!sl->id) break;
+        if (sl->hash == h) {
+            uint32_t n;
+            memcpy(&n, sl->str - sizeof(n), sizeof(n));
+            if (n == len && memcmp(sl->str, s, len) == 0)
+                return sl->id;
+        }
+        i = (i + 1) & mask;
+    }
+
+    // 新符号
+    if (t->nsyms + 1 >= t->sym_cap) {
+        uint32_t cap = t->sym_cap ? t->sym_cap * 2 : 1024;
+        intern_sym *syms = realloc(t->syms, (size_t)cap * sizeof(intern_sym));
+        if (!syms) return 0;
+        t->syms = syms;
+        t->sym_cap = cap;
+    }
+    char *p = arena_alloc(t, sizeof(len) + len + 1);
+    if (!p) return 0;
+    memcpy(p, &len, sizeof(len));   // 长度前缀
+    p += sizeof(len);
+    memcpy(p, s, len);
+    p[len] = '\0';
+
+    uint32_t id = ++t->nsyms;
+    t->syms[id].str = p;
+    t->syms[id].len = len;
+    t->slots[i].hash = h;
+    t->slots[i].id = id;
+    t->slots[i].str = p;
+    return id;
+}
+
+void intern_get_stats(const intern_table *t, intern_stats *st) {
+    st->nsyms = t->nsyms;
+    st->nslots = t->nslots;
+    st->load = t->nslots ? (double)t->nsyms / t->nslots : 0;
+    st->arena_bytes = t->arena_bytes;
+    st->lookups = t->lookups;
+    st->avg_probes = t->lookups ? (double)t->probes / t->lookups : 0;
+}
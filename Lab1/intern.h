@@ -0,0 +1,68 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+// 标识符 / 字符串驻留表
+//
+// 相同的词素只存一份，并得到一个从 1 开始连续编号的 32 位符号 ID，
+// 后续阶段比较 ID 即可，不必再比较、拷贝字符串。
+// 字符串存放在分块的 arena 中，表销毁前地址不变，每个字符串前存 4 字节长度；
+// 哈希表用开放定址（线性探测），桶中存哈希值、ID 和字符串地址，
+// 命中时只需访问桶和字符串本身，扩容时不移动字符串。
+// 不加锁，多个线程共用一张表时由调用方保证互斥。
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    const char *str;        // 以 '\0' 结尾
+    uint32_t len;           // 长度（不含结尾 '\0'，中间可以有 '\0'）
+} intern_sym;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t id;            // 0 表示空桶
+    const char *str;        // 同 syms[id].str
+} intern_slot;
+
+typedef struct intern_chunk intern_chunk;
+
+typedef struct {
+    intern_slot *slots;
+    uint32_t nslots;        // 桶数，2 的幂
+    intern_sym *syms;       // syms[id]，0 号不用
+    uint32_t nsyms;         // 符号数，即最大 ID
+    uint32_t sym_cap;
+    intern_chunk *chunks;   // arena 块链表，表头为当前块
+    size_t arena_bytes;     // arena 中字符串占用的字节数
+
+    unsigned long long lookups;     // 查找次数
+    unsigned long long probes;      // 探测的桶数之和
+} intern_table;
+
+typedef struct {
+    uint32_t nsyms;         // 不同符号数
+    uint32_t nslots;        // 桶数
+    double load;            // 装载因子 nsyms / nslots
+    size_t arena_bytes;
+    unsigned long long lookups;
+    double avg_probes;      // 平均每次查找探测的桶数
+} intern_stats;
+
+// 失败返回 -1
+int intern_init(intern_table *t);
+void intern_free(intern_table *t);
+
+// 驻留 [s, s + len)，返回符号 ID；内存不足返回 0
+uint32_t intern(intern_table *t, const char *s, uint32_t len);
+
+void intern_get_stats(const intern_table *t, intern_stats *st);
+
+static inline const char *intern_str(const intern_table *t, uint32_t id) {
+    return t->syms[id].str;
+}
+
+static inline uint32_t intern_len(const intern_table *t, uint32_t id) {
+    return t->syms[id].len;
+}
+
+#endif
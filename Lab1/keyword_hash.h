@@ -0,0 +1,62 @@
+// 由 gen_keywords.c 根据 pl0_sym.h 生成，请勿手工修改
+#ifndef KEYWORD_HASH_H
+#define KEYWORD_HASH_H
+
+#include <string.h>
+
+#define KW_COUNT      14
+#define KW_MIN_LEN    2
+#define KW_MAX_LEN    9
+#define KW_TABLE_SIZE 32
+
+static const struct {
+    const char *name;
+    int len;
+    int sym;
+} kw_table[KW_TABLE_SIZE] = {
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "procedure", 9, SYM_PROCEDURE },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "write", 5, SYM_WRITE },
+    { "else", 4, SYM_ELSE },
+    { "", 0, 0 },
+    { "end", 3, SYM_END },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "var", 3, SYM_VAR },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "writeln", 7, SYM_WRITELN },
+    { "while", 5, SYM_WHILE },
+    { "", 0, 0 },
+    { "do", 2, SYM_DO },
+    { "", 0, 0 },
+    { "call", 4, SYM_CALL },
+    { "then", 4, SYM_THEN },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "for", 3, SYM_FOR },
+    { "const", 5, SYM_CONST },
+    { "", 0, 0 },
+    { "", 0, 0 },
+    { "if", 2, SYM_IF },
+    { "", 0, 0 },
+    { "begin", 5, SYM_BEGIN },
+};
+
+// 关键字返回对应 SYM_*，否则返回 0
+static inline int keyword_lookup(const char *s, int len) {
+    if (len < KW_MIN_LEN || len > KW_MAX_LEN) return 0;
+    unsigned h = (len + (unsigned char)s[0] * 1u + (unsigned char)s[1] * 2u
+                  + (unsigned char)s[len - 1] * 1u)
+                 & (KW_TABLE_SIZE - 1);
+    if (kw_table[h].len == len && memcmp(s, kw_table[h].name, len) == 0)
+        return kw_table[h].sym;
+    return 0;
+}
+
+#endif
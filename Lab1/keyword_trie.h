@@ -0,0 +1,73 @@
+// 由 gen_keywords.c 根据 pl0_sym.h 生成，请勿手工修改
+#ifndef KEYWORD_TRIE_H
+#define KEYWORD_TRIE_H
+
+#define KW_COUNT       14
+#define KW_TRIE_STATES 55
+#define KW_TRIE_ROOT   1
+
+// kw_trie[s][c]：状态 s 读入字符 c 后的状态。0 为死状态，到此不可能再是关键字，此后一直为 0。
+// c 为标识符中的字符（字母、数字，都小于 128），表中只列出关键字用到的小写字母
+static const unsigned char kw_trie[KW_TRIE_STATES][128] = {
+    [1] = { ['b'] = 23, ['c'] = 45, ['d'] = 53, ['e'] = 11, ['f'] = 20, ['i'] = 5, ['p'] = 34, ['t'] = 7, ['v'] = 2, ['w'] = 15 }, // ""
+    [2] = { ['a'] = 3 },                                // "v"
+    [3] = { ['r'] = 4 },                                // "va"
+    [5] = { ['f'] = 6 },                                // "i"
+    [7] = { ['h'] = 8 },                                // "t"
+    [8] = { ['e'] = 9 },                                // "th"
+    [9] = { ['n'] = 10 },                               // "the"
+    [11] = { ['l'] = 12, ['n'] = 43 },                  // "e"
+    [12] = { ['s'] = 13 },                              // "el"
+    [13] = { ['e'] = 14 },                              // "els"
+    [15] = { ['h'] = 16, ['r'] = 28 },                  // "w"
+    [16] = { ['i'] = 17 },                              // "wh"
+    [17] = { ['l'] = 18 },                              // "whi"
+    [18] = { ['e'] = 19 },                              // "whil"
+    [20] = { ['o'] = 21 },                              // "f"
+    [21] = { ['r'] = 22 },                              // "fo"
+    [23] = { ['e'] = 24 },                              // "b"
+    [24] = { ['g'] = 25 },                              // "be"
+    [25] = { ['i'] = 26 },                              // "beg"
+    [26] = { ['n'] = 27 },                              // "begi"
+    [28] = { ['i'] = 29 },                              // "wr"
+    [29] = { ['t'] = 30 },                              // "wri"
+    [30] = { ['e'] = 31 },                              // "writ"
+    [31] = { ['l'] = 32 },                              // "write"
+    [32] = { ['n'] = 33 },                              // "writel"
+    [34] = { ['r'] = 35 },                              // "p"
+    [35] = { ['o'] = 36 },                              // "pr"
+    [36] = { ['c'] = 37 },                              // "pro"
+    [37] = { ['e'] = 38 },                              // "proc"
+    [38] = { ['d'] = 39 },                              // "proce"
+    [39] = { ['u'] = 40 },                              // "proced"
+    [40] = { ['r'] = 41 },                              // "procedu"
+    [41] = { ['e'] = 42 },                              // "procedur"
+    [43] = { ['d'] = 44 },                              // "en"
+    [45] = { ['a'] = 50, ['o'] = 46 },                  // "c"
+    [46] = { ['n'] = 47 },                              // "co"
+    [47] = { ['s'] = 48 },                              // "con"
+    [48] = { ['t'] = 49 },                              // "cons"
+    [50] = { ['l'] = 51 },                              // "ca"
+    [51] = { ['l'] = 52 },                              // "cal"
+    [53] = { ['o'] = 54 },                              // "d"
+};
+
+// 在状态 s 处结束的标识符的种别，0 表示不是关键字
+static const unsigned char kw_accept[KW_TRIE_STATES] = {
+    [4] = SYM_VAR,              // "var"
+    [6] = SYM_IF,               // "if"
+    [10] = SYM_THEN,            // "then"
+    [14] = SYM_ELSE,            // "else"
+    [19] = SYM_WHILE,           // "while"
+    [22] = SYM_FOR,             // "for"
+    [27] = SYM_BEGIN,           // "begin"
+    [31] = SYM_WRITE,           // "write"
+    [33] = SYM_WRITELN,         // "writeln"
+    [42] = SYM_PROCEDURE,       // "procedure"
+    [44] = SYM_END,             // "end"
+    [49] = SYM_CONST,           // "const"
+    [52] = SYM_CALL,            // "call"
+    [54] = SYM_DO,              // "do"
+};
+
+#endif
@@ -352,8 +352,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 39
-#define YY_END_OF_BUFFER 40
+#define YY_NUM_RULES 51
+#define YY_END_OF_BUFFER 52
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -361,23 +361,26 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[88] =
+static const flex_int16_t yy_accept[110] =
     {   0,
-        0,    0,   40,   38,   37,   37,   36,   29,   30,   24,
-       22,   34,   23,   35,   25,   17,   38,   33,   28,   26,
-       27,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   31,   32,   37,   17,   16,   18,   20,   19,
-       21,   15,   15,   15,   15,   13,   15,   15,   15,    2,
-       15,   15,   15,   15,   15,   16,   15,   15,   15,   15,
-       10,    6,   15,   15,    1,   15,   15,   15,   12,   15,
-        4,   15,    3,   15,   15,    7,   11,   15,    5,   14,
-       15,   15,   15,    8,   15,    9,    0
+        0,    0,    0,    0,    0,    0,   52,   44,   43,   43,
+       41,   29,   30,   24,   22,   38,   23,   39,   25,   17,
+       44,   37,   28,   26,   27,   15,   31,   32,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   34,   36,
+       45,   47,   46,   45,   48,   50,   49,   48,   43,   41,
+       40,   42,   17,   16,   18,   20,   19,   21,   15,   15,
+       15,   15,   13,   15,   15,   15,    2,   15,   15,   15,
+       15,   15,   34,   33,   35,   45,   48,   16,   15,   15,
+       15,   15,   10,    6,   15,   15,    1,   15,   15,   15,
+       12,   15,    4,   15,    3,   15,   15,    7,   11,   15,
+
+        5,   14,   15,   15,   15,    8,   15,    9,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
+        2,    2,    2,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    2,    1,    4,    1,    1,    1,    1,    1,    5,
         6,    7,    8,    9,   10,   11,   12,   13,   13,   13,
@@ -385,11 +388,11 @@ static const YY_CHAR yy_ec[256] =
        17,   18,    1,    1,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-        1,    1,    1,    1,    1,    1,   20,   21,   22,   23,
+       20,    1,   21,    1,    1,    1,   22,   23,   24,   25,
 
-       24,   25,   26,   27,   28,   19,   19,   29,   19,   30,
-       31,   32,   19,   33,   34,   35,   36,   37,   38,   19,
-       19,   19,   39,    1,   40,    1,    1,    1,    1,    1,
+       26,   27,   28,   29,   30,   19,   19,   31,   19,   32,
+       33,   34,   19,   35,   36,   37,   38,   39,   40,   19,
+       19,   19,   41,    1,   42,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -406,76 +409,205 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[41] =
+static const YY_CHAR yy_meta[44] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    2,    1,    1,    1,    1,    1,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[91] =
+static const flex_int16_t yy_base[110] =
     {   0,
-        0,    0,   99,  100,   39,   41,  100,  100,  100,  100,
-      100,  100,  100,  100,  100,   85,   80,  100,   28,  100,
-       79,    0,   71,   27,   63,   19,   62,   67,   58,   63,
-       69,   23,  100,  100,   49,   75,    0,  100,  100,  100,
-      100,    0,   61,   57,   55,    0,   50,   60,   49,    0,
-       50,   56,   46,   50,   49,    0,   48,   46,   40,   49,
-        0,    0,   50,   41,    0,   41,   34,   38,    0,   32,
-        0,   42,    0,   41,   40,    0,    0,   40,    0,   33,
-       25,   30,   26,    0,   33,    0,  100,   53,   52,   51
+        0,    0,   43,   43,   86,   86,  130,  648,  129,  129,
+      132,  648,  648,  648,  648,  648,  648,  648,  648,  163,
+      118,  648,  160,  648,  162,  191,  648,  648,  154,  210,
+      148,  152,  172,  179,  172,  179,  187,  204,  240,  648,
+      283,  648,  648,  648,  324,  648,  648,  648,  209,  366,
+      648,  648,  397,  425,  648,  648,  648,  648,  453,  206,
+      204,  204,  191,  201,  213,  205,  191,  253,  301,  293,
+      339,  381,  493,  648,  648,  536,  577,  607,  382,  382,
+      378,  389,  191,  191,  393,  386,  191,  408,  403,  409,
+      191,  405,  191,  417,  191,  419,  420,  191,  191,  442,
+
+      191,  437,  431,  438,  436,  191,  447,  191,  648
     } ;
 
-static const flex_int16_t yy_def[91] =
+static const flex_int16_t yy_def[110] =
     {   0,
-       87,    1,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   88,   87,   87,   87,   87,
-       87,   89,   89,   89,   89,   89,   89,   89,   89,   89,
-       89,   89,   87,   87,   87,   88,   90,   87,   87,   87,
-       87,   89,   89,   89,   89,   89,   89,   89,   89,   89,
-       89,   89,   89,   89,   89,   90,   89,   89,   89,   89,
-       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
-       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
-       89,   89,   89,   89,   89,   89,    0,   87,   87,   87
+      109,    1,  109,    3,  109,    5,  109,  109,  109,    9,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,  109,  109,  109,  109,  109,  109,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+
+       26,   26,   26,   26,   26,   26,   26,   26,    0
     } ;
 
-static const flex_int16_t yy_nxt[141] =
+static const flex_int16_t yy_nxt[692] =
     {   0,
-        4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
-       14,   15,   16,   17,   18,   19,   20,   21,   22,   22,
-       23,   24,   25,   26,   27,   22,   22,   28,   22,   22,
-       22,   29,   22,   22,   30,   22,   31,   32,   33,   34,
-       35,   35,   35,   35,   39,   40,   44,   47,   48,   54,
-       35,   35,   56,   42,   37,   55,   86,   45,   85,   84,
-       83,   82,   81,   80,   79,   78,   77,   76,   75,   74,
-       73,   72,   71,   70,   69,   68,   67,   66,   65,   64,
-       63,   62,   61,   60,   59,   58,   57,   36,   53,   52,
-       51,   50,   49,   46,   43,   41,   38,   36,   87,    3,
-
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87
+        8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+       28,   26,   29,   30,   31,   32,   33,   26,   26,   34,
+       26,   26,   26,   35,   26,   26,   36,   26,   37,   38,
+       39,   40,    8,   41,   41,   42,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   43,   44,   45,   45,   46,   47,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   48,  109,
+       49,   49,   50,   50,   55,   51,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   52,   53,   56,   57,   58,   60,
+       63,   54,   64,   65,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   54,   59,   66,   67,   68,   69,   70,   59,
+       49,   49,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   61,   71,   79,   80,   81,   82,   83,   72,   84,
+       73,   73,   62,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   74,   75,   76,   76,   85,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   77,   77,   86,   87,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   50,   50,   88,   51,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   52,   53,
+       89,   90,   91,   92,   93,   54,   94,   95,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   78,   96,   97,
+       98,   99,  100,   78,  101,  102,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   59,  103,  104,  105,  106,
+      107,   59,  108,    0,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   73,   73,    0,   73,   73,   73,   73,
+
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   74,   75,   76,   76,    0,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   77,   77,    0,
+        0,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   78,
+        0,    0,    0,    0,    0,   78,    0,    0,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,    7,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109
     } ;
 
-static const flex_int16_t yy_chk[141] =
+static const flex_int16_t yy_chk[692] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        5,    5,    6,    6,   19,   19,   24,   26,   26,   32,
-       35,   35,   90,   89,   88,   32,   85,   24,   83,   82,
-       81,   80,   78,   75,   74,   72,   70,   68,   67,   66,
-       64,   63,   60,   59,   58,   57,   55,   54,   53,   52,
-       51,   49,   48,   47,   45,   44,   43,   36,   31,   30,
-       29,   28,   27,   25,   23,   21,   17,   16,    3,   87,
-
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87
+        1,    1,    1,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    7,
+        9,    9,   11,   11,   21,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   20,   23,   23,   25,   29,
+       31,   20,   32,   32,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+
+       20,   20,   20,   26,   33,   34,   35,   36,   37,   26,
+       49,   49,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   30,   38,   60,   61,   62,   64,   65,   38,   66,
+       39,   39,   30,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   41,   41,   68,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   45,   45,   69,   70,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   50,   50,   71,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   53,
+       72,   79,   80,   81,   82,   53,   85,   86,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   54,   88,   89,
+       90,   92,   94,   54,   96,   97,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   59,  100,  102,  103,  104,
+      105,   59,  107,    0,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   73,   73,    0,   73,   73,   73,   73,
+
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   76,   76,    0,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   77,   77,    0,
+        0,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   78,
+        0,    0,    0,    0,    0,   78,    0,    0,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -494,9 +626,14 @@ int yy_flex_debug = 0;
 char *yytext;
 #line 1 "pl0_lexer.l"
 #line 2 "pl0_lexer.l"
+// 编译: flex pl0_lexer.l && gcc lex.yy.c tokwriter.c -o pl0_lexer
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <unistd.h>
+
+#include "tokwriter.h"
 
 // token types
 enum {
@@ -536,17 +673,53 @@ enum {
     SYM_WRITE = 34,
     SYM_PERIOD = 35,
     SYM_STRING = 36,
+    SYM_LBRACKET = 37,
+    SYM_RBRACKET = 38,
     SYM_ERROR = 100
 };
 
-// 字符串缓冲区
-char string_buf[1000];
-int string_len = 0;
+// 注释 / 字符串中遇到 NUL 后转入起始条件 COMMENT / STR 逐段读完：整个作为一个词素时，
+// flex 每遇到一个 NUL 都要从词素开头重新扫描，NUL 多时是平方复杂度。
+// 字符串只输出到第一个 NUL，这部分先记在这里，读到结尾的引号再写出。放不下时加倍，字符串不限长度
+char *string_buf = NULL;
+size_t string_cap = 0;
+size_t string_len = 0;
+
+// 所有 token 经缓冲写出器输出
+tokwriter tw_out;
+
+static void save_string(const char *s, size_t n) {
+    if (n + 1 > string_cap) {
+        size_t cap = string_cap ? string_cap : 1024;
+        while (cap < n + 1) cap *= 2;
+        char *p = realloc(string_buf, cap);
+        if (!p) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        string_buf = p;
+        string_cap = cap;
+    }
+    memcpy(string_buf, s, n);
+    string_len = n;
+}
 
-#line 546 "lex.yy.c"
-#line 547 "lex.yy.c"
+// 与手写分析器一致：超过 INT64_MAX 的数字记为错误。不到 19 位的数字不会溢出，不必再看
+static int num_overflows(const char *s, size_t n) {
+    if (n < 19) return 0;
+    while (n > 1 && *s == '0') {    // 去掉前导 0
+        s++;
+        n--;
+    }
+    return n > 19 || (n == 19 && memcmp(s, "9223372036854775807", 19) > 0);
+}
+
+#line 717 "lex.yy.c"
+#line 718 "lex.yy.c"
 
 #define INITIAL 0
+#define COMMENT 1
+#define STR 2
 
 #ifndef YY_NO_UNISTD_H
 /* Special case for "unistd.h", since it is non-ANSI. We include it way
@@ -761,10 +934,10 @@ YY_DECL
 		}
 
 	{
-#line 58 "pl0_lexer.l"
+#line 99 "pl0_lexer.l"
 
 
-#line 767 "lex.yy.c"
+#line 940 "lex.yy.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -791,13 +964,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 88 )
+				if ( yy_current_state >= 110 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 100 );
+		while ( yy_base[yy_current_state] != 648 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -823,234 +996,271 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 60 "pl0_lexer.l"
-{ printf("(21, \"%s\")\n", yytext); }
+#line 101 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_VAR, yytext, yyleng); }
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 61 "pl0_lexer.l"
-{ printf("(22, \"%s\")\n", yytext); }
+#line 102 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_IF, yytext, yyleng); }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 62 "pl0_lexer.l"
-{ printf("(23, \"%s\")\n", yytext); }
+#line 103 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_THEN, yytext, yyleng); }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 63 "pl0_lexer.l"
-{ printf("(24, \"%s\")\n", yytext); }
+#line 104 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_ELSE, yytext, yyleng); }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 64 "pl0_lexer.l"
-{ printf("(25, \"%s\")\n", yytext); }
+#line 105 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_WHILE, yytext, yyleng); }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 65 "pl0_lexer.l"
-{ printf("(26, \"%s\")\n", yytext); }
+#line 106 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_FOR, yytext, yyleng); }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 66 "pl0_lexer.l"
-{ printf("(27, \"%s\")\n", yytext); }
+#line 107 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_BEGIN, yytext, yyleng); }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 67 "pl0_lexer.l"
-{ printf("(28, \"%s\")\n", yytext); }
+#line 108 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_WRITELN, yytext, yyleng); }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 68 "pl0_lexer.l"
-{ printf("(29, \"%s\")\n", yytext); }
+#line 109 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_PROCEDURE, yytext, yyleng); }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 69 "pl0_lexer.l"
-{ printf("(30, \"%s\")\n", yytext); }
+#line 110 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_END, yytext, yyleng); }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 70 "pl0_lexer.l"
-{ printf("(31, \"%s\")\n", yytext); }
+#line 111 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_CONST, yytext, yyleng); }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 71 "pl0_lexer.l"
-{ printf("(32, \"%s\")\n", yytext); }
+#line 112 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_CALL, yytext, yyleng); }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 72 "pl0_lexer.l"
-{ printf("(33, \"%s\")\n", yytext); }
+#line 113 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_DO, yytext, yyleng); }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 73 "pl0_lexer.l"
-{ printf("(34, \"%s\")\n", yytext); }
+#line 114 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_WRITE, yytext, yyleng); }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 75 "pl0_lexer.l"
-{ printf("(1, \"%s\")\n", yytext); }
+#line 116 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_IDENTIFIER, yytext, yyleng); }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 76 "pl0_lexer.l"
-{ printf("(100, \"%s\")\n", yytext); }  /* 数字后接字母的错误 */
+#line 117 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_ERROR, yytext, yyleng); }  /* 数字后接字母的错误 */
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 77 "pl0_lexer.l"
-{ printf("(2, %s)\n", yytext); }
+#line 118 "pl0_lexer.l"
+{ tw_token(&tw_out, num_overflows(yytext, yyleng) ? SYM_ERROR : SYM_NUMBER, yytext, yyleng); }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 79 "pl0_lexer.l"
-{ printf("(20, \":=\")\n"); }
+#line 120 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_ASSIGN, yytext, yyleng); }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 80 "pl0_lexer.l"
-{ printf("(10, \"<>\")\n"); }
+#line 121 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_NEQ, yytext, yyleng); }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 81 "pl0_lexer.l"
-{ printf("(11, \"<=\")\n"); }
+#line 122 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_LEQ, yytext, yyleng); }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 82 "pl0_lexer.l"
-{ printf("(12, \">=\")\n"); }
+#line 123 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_GEQ, yytext, yyleng); }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 84 "pl0_lexer.l"
-{ printf("(3, \"+\")\n"); }
+#line 125 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_PLUS, yytext, yyleng); }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 85 "pl0_lexer.l"
-{ printf("(4, \"-\")\n"); }
+#line 126 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_MINUS, yytext, yyleng); }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 86 "pl0_lexer.l"
-{ printf("(5, \"*\")\n"); }
+#line 127 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_TIMES, yytext, yyleng); }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 87 "pl0_lexer.l"
-{ printf("(6, \"/\")\n"); }
+#line 128 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_SLASH, yytext, yyleng); }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 88 "pl0_lexer.l"
-{ printf("(7, \"=\")\n"); }
+#line 129 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_EQU, yytext, yyleng); }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 89 "pl0_lexer.l"
-{ printf("(8, \">\")\n"); }
+#line 130 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_GTR, yytext, yyleng); }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 90 "pl0_lexer.l"
-{ printf("(9, \"<\")\n"); }
+#line 131 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_LES, yytext, yyleng); }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 91 "pl0_lexer.l"
-{ printf("(13, \"(\")\n"); }
+#line 132 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_LPAREN, yytext, yyleng); }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 92 "pl0_lexer.l"
-{ printf("(14, \")\")\n"); }
+#line 133 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_RPAREN, yytext, yyleng); }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 93 "pl0_lexer.l"
-{ 
-                  // 注释处理
-                  int c;
-                  int comment_closed = 0;
-                  while ((c = input()) != EOF && c != '\n') {
-                      if (c == '}') {
-                          comment_closed = 1;
-                          break;
-                      }
-                  }
-                  if (!comment_closed) {
-                      printf("(100, \"=== Unclosed comment ===\")\n");
-                  }
-                }
+#line 134 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_LBRACKET, yytext, yyleng); }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 107 "pl0_lexer.l"
-{ printf("(100, \"%s\")\n", yytext); }  // 单独的 } 应该报错
+#line 135 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_RBRACKET, yytext, yyleng); }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 108 "pl0_lexer.l"
-{ printf("(17, \";\")\n"); }
+#line 136 "pl0_lexer.l"
+{ /* 跳过注释 */ }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 109 "pl0_lexer.l"
-{ printf("(18, \",\")\n"); }
+#line 137 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed comment ==="); }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 110 "pl0_lexer.l"
-{ printf("(35, \".\")\n"); }
+#line 138 "pl0_lexer.l"
+{ BEGIN(COMMENT); }  /* 注释中的 NUL 不结束注释，余下部分在 COMMENT 中逐段跳过 */
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 112 "pl0_lexer.l"
-{
-                  // 字符串处理
-                  string_len = 0;
-                  int c;
-                  int string_closed = 0;
-                  while ((c = input()) != EOF && c != '\n') {
-                      if (c == '"') {
-                          string_closed = 1;
-                          break;
-                      }
-                      if (string_len < sizeof(string_buf) - 1) {
-                          string_buf[string_len++] = c;
-                      }
-                  }
-                  if (!string_closed) {
-                      printf("(100, \"=== Unclosed string ===\")\n");
-                  } else {
-                      string_buf[string_len] = '\0';
-                      printf("(36, \"%s\")\n", string_buf);
-                  }
-                }
+#line 139 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_ERROR, yytext, yyleng); }  // 单独的 } 应该报错
 	YY_BREAK
 case 37:
-/* rule 37 can match eol */
 YY_RULE_SETUP
-#line 134 "pl0_lexer.l"
-{ /* 跳过分隔符 */ }
+#line 140 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_SEMICOLON, yytext, yyleng); }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 136 "pl0_lexer.l"
-{ printf("(100, \"%s\")\n", yytext); }
+#line 141 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_COMMA, yytext, yyleng); }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 138 "pl0_lexer.l"
+#line 142 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_PERIOD, yytext, yyleng); }
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+#line 144 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_STRING, yytext + 1, yyleng - 2); }
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+#line 145 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed string ==="); }
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+#line 146 "pl0_lexer.l"
+{ save_string(yytext + 1, yyleng - 2); BEGIN(STR); }  /* 同上，在 STR 中读到结尾 */
+	YY_BREAK
+case 43:
+/* rule 43 can match eol */
+YY_RULE_SETUP
+#line 148 "pl0_lexer.l"
+{ /* 跳过分隔符 */ }
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 150 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_ERROR, yytext, strlen(yytext)); }  /* 与 printf("%s") 一致，NUL 字节输出为空 */
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 152 "pl0_lexer.l"
+{ }
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 153 "pl0_lexer.l"
+{ BEGIN(INITIAL); }
+	YY_BREAK
+case 47:
+/* rule 47 can match eol */
+YY_RULE_SETUP
+#line 154 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed comment ==="); BEGIN(INITIAL); }
+	YY_BREAK
+case YY_STATE_EOF(COMMENT):
+#line 155 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed comment ==="); BEGIN(INITIAL); yyterminate(); }
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 157 "pl0_lexer.l"
+{ }
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+#line 158 "pl0_lexer.l"
+{ tw_token(&tw_out, SYM_STRING, string_buf, string_len); BEGIN(INITIAL); }
+	YY_BREAK
+case 50:
+/* rule 50 can match eol */
+YY_RULE_SETUP
+#line 159 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed string ==="); BEGIN(INITIAL); }
+	YY_BREAK
+case YY_STATE_EOF(STR):
+#line 160 "pl0_lexer.l"
+{ TW_LIT(&tw_out, SYM_ERROR, "=== Unclosed string ==="); BEGIN(INITIAL); yyterminate(); }
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+#line 162 "pl0_lexer.l"
 ECHO;
 	YY_BREAK
-#line 1053 "lex.yy.c"
+#line 1263 "lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -1338,7 +1548,7 @@ static int yy_get_next_buffer (void)
 
 	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
 		{
-		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 43);
 		if ( yy_accept[yy_current_state] )
 			{
 			(yy_last_accepting_state) = yy_current_state;
@@ -1347,7 +1557,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 88 )
+			if ( yy_current_state >= 110 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1366,7 +1576,7 @@ static int yy_get_next_buffer (void)
 	int yy_is_jam;
     	char *yy_cp = (yy_c_buf_p);
 
-	YY_CHAR yy_c = 1;
+	YY_CHAR yy_c = 43;
 	if ( yy_accept[yy_current_state] )
 		{
 		(yy_last_accepting_state) = yy_current_state;
@@ -1375,11 +1585,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 88 )
+		if ( yy_current_state >= 110 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 87);
+	yy_is_jam = (yy_current_state == 109);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2055,14 +2265,18 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 138 "pl0_lexer.l"
+#line 162 "pl0_lexer.l"
 
 
 int yywrap(void) {
     return 1;
 }
 
+// 基准程序（bench_lex.c）直接调用 yylex，编译时定义 PL0_LEXER_NO_MAIN 去掉 main
+#ifndef PL0_LEXER_NO_MAIN
 int main(void) {
+    if (tw_init(&tw_out, STDOUT_FILENO) != 0) return 1;
     yylex();
-    return 0;
+    return tw_close(&tw_out) != 0;
 }
+#endif
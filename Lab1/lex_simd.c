@@ -0,0 +1,382 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lex_simd.h"
+
+#if defined(__SSE2__)
+#define LEX_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+//=========================
+//     标量实现
+//=========================
+static inline int is_space(unsigned char c) {
+    return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+static inline int is_alnum(unsigned char c) {
+    return (unsigned char)(c - '0') <= 9 || (unsigned char)((c | 0x20) - 'a') <= 25;
+}
+
+static const unsigned char *skip_space_scalar(const unsigned char *p, const unsigned char *end) {
+    while (p < end && is_space(*p)) p++;
+    return p;
+}
+
+static const unsigned char *span_alnum_scalar(const unsigned char *p, const unsigned char *end) {
+    while (p < end && is_alnum(*p)) p++;
+    return p;
+}
+
+static const unsigned char *find2_scalar(const unsigned char *p, const unsigned char *end,
+                                         unsigned char a, unsigned char b) {
+    while (p < end && *p != a && *p != b) p++;
+    return p;
+}
+
+int lex_utf8_seq(const unsigned char *p, const unsigned char *end) {
+    unsigned c = p[0];
+    unsigned lo = 0x80, hi = 0xbf;      // 第二个字节的范围，之后的字节都是 80..BF
+    int n;
+    if (c < 0x80) return 1;
+    if (c < 0xc2) return -1;            // 单独的后续字节，或 C0 / C1 开头的超长编码
+    if (c < 0xe0) {
+        n = 2;
+    } else if (c < 0xf0) {
+        n = 3;
+        if (c == 0xe0) lo = 0xa0;       // 超长编码
+        if (c == 0xed) hi = 0x9f;       // 代理项 D800..DFFF
+    } else if (c < 0xf5) {
+        n = 4;
+        if (c == 0xf0) lo = 0x90;       // 超长编码
+        if (c == 0xf4) hi = 0x8f;       // 超过 U+10FFFF
+    } else {
+        return -1;
+    }
+    for (int i = 1; i < n; i++) {
+        if (p + i >= end) return 0;
+        if (p[i] < lo || p[i] > hi) return -1;
+        lo = 0x80;
+        hi = 0xbf;
+    }
+    return n;
+}
+
+// 从非 ASCII 字节 p 开始逐个校验多字节序列，直到回到 ASCII 或 end。
+// 不合法时 *bad 置为该序列的起点
+static inline const unsigned char *utf8_run(const unsigned char *p, const unsigned char *end,
+                                            const unsigned char **bad) {
+    do {
+        int n = lex_utf8_seq(p, end);
+        if (n <= 0) {
+            *bad = p;
+            return end;
+        }
+        p += n;
+    } while (p < end && *p >= 0x80);
+    return p;
+}
+
+static const unsigned char *utf8_check_scalar(const unsigned char *p, const unsigned char *end) {
+    const unsigned char *bad = NULL;
+    while (p < end && !bad) {
+        // ASCII 一次看 8 字节
+        uint64_t w;
+        if (end - p >= 8 && (memcpy(&w, p, 8), !(w & 0x8080808080808080ULL))) {
+            p += 8;
+            continue;
+        }
+        if (*p < 0x80) p++;
+        else p = utf8_run(p, end, &bad);
+    }
+    return bad ? bad : p;
+}
+
+#ifdef LEX_SIMD_X86
+
+// 无符号 x <= n：min(x, n) == x
+#define LE_EPU8(x, n)     _mm_cmpeq_epi8(_mm_min_epu8((x), (n)), (x))
+#define LE_EPU8_256(x, n) _mm256_cmpeq_epi8(_mm256_min_epu8((x), (n)), (x))
+
+//=========================
+//     SSE2 实现（16 字节一组）
+//=========================
+static inline __m128i space_mask_sse2(__m128i v) {
+    __m128i ctl = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                        LE_EPU8(ctl, _mm_set1_epi8('\r' - '\t')));
+}
+
+static inline __m128i alnum_mask_sse2(__m128i v) {
+    __m128i dig = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i low = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    return _mm_or_si128(LE_EPU8(dig, _mm_set1_epi8(9)), LE_EPU8(low, _mm_set1_epi8(25)));
+}
+
+static const unsigned char *skip_space_sse2(const unsigned char *p, const unsigned char *end) {
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        unsigned m = ~_mm_movemask_epi8(space_mask_sse2(v)) & 0xffff;
+        if (m) return p + __builtin_ctz(m);
+        p += 16;
+    }
+    return skip_space_scalar(p, end);
+}
+
+static const unsigned char *span_alnum_sse2(const unsigned char *p, const unsigned char *end) {
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        unsigned m = ~_mm_movemask_epi8(alnum_mask_sse2(v)) & 0xffff;
+        if (m) return p + __builtin_ctz(m);
+        p += 16;
+    }
+    return span_alnum_scalar(p, end);
+}
+
+static const unsigned char *find2_sse2(const unsigned char *p, const unsigned char *end,
+                                       unsigned char a, unsigned char b) {
+    __m128i va = _mm_set1_epi8((char)a);
+    __m128i vb = _mm_set1_epi8((char)b);
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        unsigned m = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)));
+        if (m) return p + __builtin_ctz(m);
+        p += 16;
+    }
+    return find2_scalar(p, end, a, b);
+}
+
+static const unsigned char *utf8_check_sse2(const unsigned char *p, const unsigned char *end) {
+    const unsigned char *bad = NULL;
+    while (end - p >= 16 && !bad) {
+        unsigned m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p));
+        if (!m) {
+            p += 16;
+            continue;
+        }
+        p = utf8_run(p + __builtin_ctz(m), end, &bad);
+    }
+    return bad ? bad : utf8_check_scalar(p, end);
+}
+
+//=========================
+//     AVX2 实现（32 字节一组）
+//=========================
+#define AVX2 __attribute__((target("avx2")))
+
+static inline AVX2 __m256i space_mask_avx2(__m256i v) {
+    __m256i ctl = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                           LE_EPU8_256(ctl, _mm256_set1_epi8('\r' - '\t')));
+}
+
+static inline AVX2 __m256i alnum_mask_avx2(__m256i v) {
+    __m256i dig = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    __m256i low = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    return _mm256_or_si256(LE_EPU8_256(dig, _mm256_set1_epi8(9)),
+                           LE_EPU8_256(low, _mm256_set1_epi8(25)));
+}
+
+static AVX2 const unsigned char *skip_space_avx2(const unsigned char *p, const unsigned char *end) {
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        unsigned m = ~(unsigned)_mm256_movemask_epi8(space_mask_avx2(v));
+        if (m) return p + __builtin_ctz(m);
+        p += 32;
+    }
+    return skip_space_sse2(p, end);
+}
+
+static AVX2 const unsigned char *span_alnum_avx2(const unsigned char *p, const unsigned char *end) {
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        unsigned m = ~(unsigned)_mm256_movemask_epi8(alnum_mask_avx2(v));
+        if (m) return p + __builtin_ctz(m);
+        p += 32;
+    }
+    return span_alnum_sse2(p, end);
+}
+
+static AVX2 const unsigned char *find2_avx2(const unsigned char *p, const unsigned char *end,
+                                            unsigned char a, unsigned char b) {
+    __m256i va = _mm256_set1_epi8((char)a);
+    __m256i vb = _mm256_set1_epi8((char)b);
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        unsigned m = (unsigned)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)));
+        if (m) return p + __builtin_ctz(m);
+        p += 32;
+    }
+    return find2_sse2(p, end, a, b);
+}
+
+// UTF-8 整组校验（Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"）：
+// 每个字节与前一个字节的高、低 4 位各查一张 16 项的表（pshufb），三者相与即得各类错误的标志；
+// 再由前两、三个字节判断这里是否必须是 3、4 字节序列的后续字节。只判断有没有错，
+// 出错时回到出错组里第一个字符的开头，用标量代码找出确切位置
+#define U8_TOO_SHORT   (1 << 0)     // 前导字节后面不是后续字节
+#define U8_TOO_LONG    (1 << 1)     // ASCII 后面是后续字节
+#define U8_OVERLONG_3  (1 << 2)     // E0 80..9F
+#define U8_TOO_LARGE   (1 << 3)     // F4 90..BF，F5..FF
+#define U8_SURROGATE   (1 << 4)     // ED A0..BF
+#define U8_OVERLONG_2  (1 << 5)     // C0 / C1
+#define U8_TOO_LARGE_1000 (1 << 6)  // F5..FF 80..8F
+#define U8_OVERLONG_4  (1 << 6)     // F0 80..8F
+#define U8_TWO_CONTS   (1 << 7)     // 两个后续字节，之前不是 3、4 字节序列
+#define U8_CARRY       (U8_TOO_SHORT | U8_TOO_LONG | U8_TWO_CONTS)
+
+// 16 项的表在两个 128 位通道中各放一份
+#define TABLE16(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+// in 中每个字节的错误标志，prev 为上一组
+static inline AVX2 __m256i utf8_errors_avx2(__m256i in, __m256i prev) {
+    const __m256i lo4 = _mm256_set1_epi8(0x0f);
+    __m256i carry = _mm256_permute2x128_si256(prev, in, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(in, carry, 15);
+    __m256i prev2 = _mm256_alignr_epi8(in, carry, 14);
+    __m256i prev3 = _mm256_alignr_epi8(in, carry, 13);
+
+    __m256i byte_1_high = _mm256_shuffle_epi8(TABLE16(
+        // 0_______：ASCII
+        U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,
+        U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,
+        // 10______：后续字节
+        U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS,
+        // 1100____ / 1101____：2 字节前导
+        U8_TOO_SHORT | U8_OVERLONG_2,
+        U8_TOO_SHORT,
+        // 1110____：3 字节前导
+        U8_TOO_SHORT | U8_OVERLONG_3 | U8_SURROGATE,
+        // 1111____：4 字节前导
+        U8_TOO_SHORT | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_OVERLONG_4),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lo4));
+
+    __m256i byte_1_low = _mm256_shuffle_epi8(TABLE16(
+        U8_CARRY | U8_OVERLONG_3 | U8_OVERLONG_2 | U8_OVERLONG_4,   // ____0000
+        U8_CARRY | U8_OVERLONG_2,                                   // ____0001
+        U8_CARRY,                                                   // ____0010
+        U8_CARRY,                                                   // ____0011
+        U8_CARRY | U8_TOO_LARGE,                                    // ____0100
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,                // ____0101 ~ ____1100
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_SURROGATE, // ____1101
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,                // ____1110 / ____1111
+        U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000),
+        _mm256_and_si256(prev1, lo4));
+
+    __m256i byte_2_high = _mm256_shuffle_epi8(TABLE16(
+        // 0_______：ASCII
+        U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,
+        U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,
+        // 1000____
+        U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 | U8_TOO_LARGE_1000 | U8_OVERLONG_4,
+        // 1001____
+        U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 | U8_TOO_LARGE,
+        // 101_____
+        U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE,
+        U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE,
+        // 11______：前导字节
+        U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT),
+        _mm256_and_si256(_mm256_srli_epi16(in, 4), lo4));
+
+    __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    // 前两个字节 >= E0 或前三个字节 >= F0：这里必须是后续字节，对应上面的 U8_TWO_CONTS
+    __m256i must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xe0 - 0x80))),
+                                     _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xf0 - 0x80))));
+    __m256i must23_80 = _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must23_80, special);
+}
+
+// 包含 p[-1] 的字符的开头；[start, p) 中该字符之前的部分都已校验过
+static inline const unsigned char *utf8_char_start(const unsigned char *start, const unsigned char *p) {
+    if (p == start) return p;
+    const unsigned char *q = p - 1;
+    for (int i = 0; i < 3 && q > start && (*q & 0xc0) == 0x80; i++) q--;
+    return q;
+}
+
+static AVX2 const unsigned char *utf8_check_avx2(const unsigned char *p, const unsigned char *end) {
+    const unsigned char *start = p;
+    // 最后三个字节若是 2 / 3 / 4 字节序列的前导，这个字符在下一组才结束
+    const __m256i max_tail = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+    __m256i prev = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+
+    while (end - p >= 32) {
+        // 纯 ASCII 的部分一次看 64 字节
+        if (end - p >= 64 && _mm256_testz_si256(incomplete, incomplete)) {
+            __m256i hi = _mm256_loadu_si256((const __m256i *)(p + 32));
+            if (!_mm256_movemask_epi8(_mm256_or_si256(_mm256_loadu_si256((const __m256i *)p), hi))) {
+                prev = hi;
+                p += 64;
+                continue;
+            }
+        }
+        __m256i in = _mm256_loadu_si256((const __m256i *)p);
+        __m256i err;
+        if (!_mm256_movemask_epi8(in)) {
+            err = incomplete;           // 纯 ASCII：只要上一组没有没写完的字符
+        } else {
+            err = utf8_errors_avx2(in, prev);
+            incomplete = _mm256_subs_epu8(in, max_tail);
+        }
+        if (!_mm256_testz_si256(err, err)) break;
+        prev = in;
+        p += 32;
+    }
+    // 出错的组，或不足一组的尾部：从前一个字符的开头起逐个校验，
+    // 上一组末尾没写完的字符也一并查到
+    return utf8_check_scalar(utf8_char_start(start, p), end);
+}
+
+#endif // LEX_SIMD_X86
+
+//=========================
+//     运行时分派
+//=========================
+const unsigned char *(*lex_skip_space)(const unsigned char *, const unsigned char *) = skip_space_scalar;
+const unsigned char *(*lex_span_alnum)(const unsigned char *, const unsigned char *) = span_alnum_scalar;
+const unsigned char *(*lex_find2)(const unsigned char *, const unsigned char *,
+                                  unsigned char, unsigned char) = find2_scalar;
+const unsigned char *(*lex_utf8_check)(const unsigned char *, const unsigned char *) = utf8_check_scalar;
+
+const char *lex_simd_init(void) {
+    const char *want = getenv("LEX_SIMD");
+
+    lex_skip_space = skip_space_scalar;
+    lex_span_alnum = span_alnum_scalar;
+    lex_find2 = find2_scalar;
+    lex_utf8_check = utf8_check_scalar;
+    if (want && strcmp(want, "scalar") == 0) return "scalar";
+
+#ifdef LEX_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && !(want && strcmp(want, "sse2") == 0)) {
+        lex_skip_space = skip_space_avx2;
+        lex_span_alnum = span_alnum_avx2;
+        lex_find2 = find2_avx2;
+        lex_utf8_check = utf8_check_avx2;
+        return "avx2";
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        lex_skip_space = skip_space_sse2;
+        lex_span_alnum = span_alnum_sse2;
+        lex_find2 = find2_sse2;
+        lex_utf8_check = utf8_check_sse2;
+        return "sse2";
+    }
+#endif
+    return "scalar";
+}
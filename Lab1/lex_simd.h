@@ -0,0 +1,32 @@
+#ifndef LEX_SIMD_H
+#define LEX_SIMD_H
+
+// 词法分析的批量扫描内核：SSE2 / AVX2 版本在运行时按 CPU 选择，
+// 其他平台或不支持时退回逐字节的标量实现。
+//
+// 所有内核只读 [p, end) 范围内的字节，返回第一个不满足条件的位置，
+// 全部满足时返回 end。
+
+// 跳过空白 ' ' \t \n \v \f \r
+extern const unsigned char *(*lex_skip_space)(const unsigned char *p, const unsigned char *end);
+
+// 跳过 [A-Za-z0-9]
+extern const unsigned char *(*lex_span_alnum)(const unsigned char *p, const unsigned char *end);
+
+// 查找 a 或 b 第一次出现的位置
+extern const unsigned char *(*lex_find2)(const unsigned char *p, const unsigned char *end,
+                                        unsigned char a, unsigned char b);
+
+// 校验 UTF-8（RFC 3629：拒绝超长编码、代理项和超过 U+10FFFF 的码点）。
+// 返回第一个不合法或在 end 处不完整的序列的起点，全部合法时返回 end。
+// ASCII 部分按组判断，遇到多字节序列再逐个字符校验
+extern const unsigned char *(*lex_utf8_check)(const unsigned char *p, const unsigned char *end);
+
+// p 处一个 UTF-8 序列的长度：合法返回 1~4，不合法返回 -1，到 end 为止合法但不完整返回 0
+int lex_utf8_seq(const unsigned char *p, const unsigned char *end);
+
+// 按 CPU 特性选择实现；环境变量 LEX_SIMD=scalar|sse2|avx2 可强制指定。
+// 返回所选实现的名字
+const char *lex_simd_init(void);
+
+#endif
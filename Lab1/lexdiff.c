@@ -0,0 +1,520 @@
+// 词法分析器的差分测试：以手写 DFA 分析器（pl0lex.c）为准，比较 flex 扫描器（pl0_lexer.l）
+// 和它的可重入满表版本（pl0_lexer_r.l）
+//
+// 用法:
+//     gcc -O2 -pthread -DPL0_LEXER_NO_MAIN lexdiff.c corpus.c pl0lex.c lex_simd.c intern.c tokwriter.c lex.yy.c pl0_lexer_r.c -o lexdiff
+//     ./lexdiff [-n MB] [-k 个数] [-c 字节] [-s 种子] [-v 条数] [-w 前缀] [文件...]
+//
+//     -n 每种生成语料的大小，单位 MB，默认 4
+//     -k 变异输入的个数，默认 2000
+//     -c 每个变异输入截取的字节数，默认 2048
+//     -s 随机种子，默认 1；种子相同，输入逐字节相同
+//     -v 最多详细报告几处分歧，默认 10
+//     -w 把不一致的变异输入写到 <前缀>N.pl0，便于单独复现
+//
+// 给出文件时只比较这些文件。否则分两步：
+//     1. corpus.h 中每种配比各生成一份语料，整块比较
+//     2. 从生成语料中随机截取片段并变异：插入容易出分歧的片段
+//        （[ ] } : NUL、非 ASCII、未闭合的注释 / 字符串、超长标识符 / 数字……）、
+//        删除或重复一段、改写单个字节
+// 三边都经 tokwriter 格式化成与命令行程序相同的文本，flex 和 flex-r 各自与手写分析器逐行
+// （即逐 token）比较。每处不一致报告第一处分歧：源程序位置、该行文本和两边的 token；
+// 最后按比较的一侧和 (手写, 该侧) 的 token 种类汇总分歧，并给出三边各自的吞吐量。
+// 有分歧时退出码为 1。
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "corpus.h"
+#include "pl0lex.h"
+#include "tokwriter.h"
+
+#define BATCH_SIZE 256
+#define MAX_KINDS  64
+
+// lex.yy.c 中的扫描器与它的输出
+int yylex(void);
+int yylex_destroy(void);
+extern FILE *yyin;
+extern tokwriter tw_out;
+
+// pl0_lexer_r.c：buf[len]、buf[len + 1] 必须为 '\0'
+int pl0r_scan_mem(char *buf, size_t len, tokwriter *tw);
+
+// 一侧的累计吞吐量
+typedef struct {
+    double sec;
+    size_t bytes;
+    unsigned long long ntokens;
+} Total;
+
+// 一类分歧：与手写分析器比较的一侧（"flex" / "flex-r"）和两边第一处不同的 token 种类，
+// -1 表示该侧已没有 token
+typedef struct {
+    const char *side;
+    int man, flex;
+    size_t count;
+    char example[64];           // 第一次出现的输入名
+} Kind;
+
+Total man_total, flex_total, flex_r_total;
+Kind kinds[MAX_KINDS];
+int nkinds = 0;
+
+int verbose = 10;               // 还能详细报告的分歧数
+const char *dump_prefix = NULL;
+size_t ninputs = 0, nbad = 0;
+
+tokwriter man_out;              // 手写分析器的文本输出
+tokwriter flex_r_out;           // 可重入 flex 扫描器的文本输出
+char *scan_buf = NULL;          // 可重入 flex 扫描器就地扫描的输入副本
+size_t scan_cap = 0;
+pl0_loc *locs = NULL;           // 手写分析器各 token 的位置
+size_t locs_cap = 0;
+
+double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void out_of_memory() {
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+//=========================
+//     运行两个分析器
+//=========================
+// 返回 token 数，文本在 man_out 中，位置在 locs 中
+size_t run_manual(const char *src, size_t len) {
+    pl0_lexer *lx = pl0_lexer_open_mem(src, len);
+    if (!lx || tw_init_mem(&man_out, len * 2 + 64) != 0) out_of_memory();
+
+    size_t ntok = 0, n;
+    pl0_token toks[BATCH_SIZE];
+    while ((n = pl0_lex_batch(lx, toks, BATCH_SIZE)) > 0) {
+        if (ntok + n > locs_cap) {
+            size_t cap = locs_cap ? locs_cap * 2 : 4096;
+            while (cap < ntok + n) cap *= 2;
+            pl0_loc *p = realloc(locs, cap * sizeof(pl0_loc));
+            if (!p) out_of_memory();
+            locs = p;
+            locs_cap = cap;
+        }
+        for (size_t i = 0; i < n; i++) {
+            tw_token(&man_out, toks[i].sym, toks[i].text, pl0_print_len(&toks[i]));
+            locs[ntok + i] = toks[i].loc;
+        }
+        ntok += n;
+    }
+    if (pl0_lexer_error(lx) || man_out.error) out_of_memory();
+    pl0_lexer_close(lx);
+    return ntok;
+}
+
+// 文本在 tw_out 中。与命令行程序一样从 FILE 读入（fmemopen），
+// 连 flex 按块读入、块边界处回退的路径一起比较
+size_t run_flex(const char *src, size_t len, double *sec) {
+    double t0 = now_sec();
+    if (tw_init_mem(&tw_out, len * 2 + 64) != 0) out_of_memory();
+    // 空输入时 fmemopen 不接受 0 长度，换成 /dev/null
+    yyin = len ? fmemopen((void *)src, len, "r") : fopen("/dev/null", "r");
+    if (!yyin) out_of_memory();
+    yylex();
+    fclose(yyin);
+    yylex_destroy();
+    *sec = now_sec() - t0;
+    if (tw_out.error) out_of_memory();
+    return tw_out.ntokens;
+}
+
+// 文本在 flex_r_out 中。扫描时会临时改写输入，所以先复制一份，末尾补两个 '\0'；
+// 复制不计入时间
+size_t run_flex_r(const char *src, size_t len, double *sec) {
+    if (len + 2 > scan_cap) {
+        size_t cap = scan_cap ? scan_cap : 4096;
+        while (cap < len + 2) cap *= 2;
+        char *p = realloc(scan_buf, cap);
+        if (!p) out_of_memory();
+        scan_buf = p;
+        scan_cap = cap;
+    }
+    memcpy(scan_buf, src, len);
+    scan_buf[len] = scan_buf[len + 1] = '\0';
+
+    double t0 = now_sec();
+    if (tw_init_mem(&flex_r_out, len * 2 + 64) != 0 || pl0r_scan_mem(scan_buf, len, &flex_r_out) != 0)
+        out_of_memory();
+    *sec = now_sec() - t0;
+    if (flex_r_out.error) out_of_memory();
+    return flex_r_out.ntokens;
+}
+
+//=========================
+//     比较与报告
+//=========================
+// token 行 "(sym, ..." 中的 sym，没有 token 时为 -1
+int line_sym(const char *p, const char *end) {
+    return p < end ? atoi(p + 1) : -1;
+}
+
+const char *next_line(const char *p, const char *end) {
+    const char *nl = memchr(p, '\n', end - p);
+    return nl ? nl + 1 : end;
+}
+
+void count_kind(const char *side, int man, int flex, const char *name) {
+    for (int i = 0; i < nkinds; i++) {
+        if (kinds[i].side == side && kinds[i].man == man && kinds[i].flex == flex) {
+            kinds[i].count++;
+            return;
+        }
+    }
+    if (nkinds == MAX_KINDS) return;
+    Kind *k = &kinds[nkinds++];
+    k->side = side;
+    k->man = man;
+    k->flex = flex;
+    k->count = 1;
+    snprintf(k->example, sizeof(k->example), "%s", name);
+}
+
+// 输出不超过 max 字节，不可见字符转义
+void print_escaped(const char *p, size_t n, size_t max) {
+    for (size_t i = 0; i < n && i < max; i++) {
+        unsigned char c = p[i];
+        if (c >= 0x20 && c < 0x7f)
+            putchar(c);
+        else if (c == '\t')
+            fputs("\\t", stdout);
+        else
+            printf("\\x%02x", c);
+    }
+    if (n > max) fputs("...", stdout);
+}
+
+void print_token(const char *who, const char *p, const char *end) {
+    printf("    %-7s ", who);
+    if (p < end)
+        print_escaped(p, next_line(p, end) - p - 1, 120);
+    else
+        fputs("<end of input>", stdout);
+    putchar('\n');
+}
+
+// side 一侧在第 idx 个 token 处与手写分析器出现分歧
+void report(const char *side, const char *name, const char *src, size_t len, size_t idx, size_t nman,
+            const char *a, const char *aend, const char *b, const char *bend) {
+    // 手写分析器已没有 token 时，位置取文件尾
+    uint32_t line = 0, col = 0;
+    if (idx < nman) {
+        line = PL0_LINE(locs[idx]);
+        col = PL0_COL(locs[idx]);
+    } else {
+        line = 1;
+        for (size_t i = 0; i < len; i++)
+            if (src[i] == '\n') line++;
+    }
+    const char *ls = src, *end = src + len;
+    for (uint32_t l = 1; l < line && ls < end; l++) ls = next_line(ls, end);
+    const char *le = memchr(ls, '\n', end - ls);
+    if (!le) le = end;
+
+    if (idx < nman)
+        printf("%s: %s: token %zu at %u:%u\n", name, side, idx + 1, line, col);
+    else
+        printf("%s: %s: token %zu at end of input\n", name, side, idx + 1);
+    printf("    | ");
+    print_escaped(ls, le - ls, 160);
+    putchar('\n');
+    print_token("manual", a, aend);
+    print_token(side, b, bend);
+}
+
+// 逐行比较手写分析器与 side 一侧的输出，一致返回 0，否则计数并报告第一处分歧
+int compare_side(const char *side, const tokwriter *out, const char *name, const char *src, size_t len,
+                 size_t nman) {
+    const char *a = man_out.buf, *aend = a + man_out.len;
+    const char *b = out->buf, *bend = b + out->len;
+    size_t idx = 0;
+    while (a < aend || b < bend) {
+        const char *an = next_line(a, aend), *bn = next_line(b, bend);
+        if (an - a != bn - b || memcmp(a, b, an - a) != 0) {
+            count_kind(side, line_sym(a, aend), line_sym(b, bend), name);
+            if (verbose > 0) {
+                verbose--;
+                report(side, name, src, len, idx, nman, a, aend, b, bend);
+            }
+            return 1;
+        }
+        a = an;
+        b = bn;
+        idx++;
+    }
+    return 0;
+}
+
+// 三边各跑一遍并比较，一致返回 0。src[len] 必须为 '\0'
+int diff_one(const char *name, const char *src, size_t len) {
+    double t0 = now_sec();
+    size_t nman = run_manual(src, len);
+    double man_sec = now_sec() - t0;
+    double flex_sec, flex_r_sec;
+    size_t nflex = run_flex(src, len, &flex_sec);
+    size_t nflex_r = run_flex_r(src, len, &flex_r_sec);
+
+    man_total.sec += man_sec;
+    man_total.bytes += len;
+    man_total.ntokens += nman;
+    flex_total.sec += flex_sec;
+    flex_total.bytes += len;
+    flex_total.ntokens += nflex;
+    flex_r_total.sec += flex_r_sec;
+    flex_r_total.bytes += len;
+    flex_r_total.ntokens += nflex_r;
+    ninputs++;
+
+    int bad = compare_side("flex", &tw_out, name, src, len, nman);
+    bad |= compare_side("flex-r", &flex_r_out, name, src, len, nman);
+    if (bad) nbad++;
+    tw_close(&man_out);
+    tw_close(&tw_out);
+    tw_close(&flex_r_out);
+    return bad;
+}
+
+//=========================
+//     变异
+//=========================
+uint64_t rng;
+
+// xorshift64
+uint32_t next_rand() {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (uint32_t)(rng >> 32);
+}
+
+// [0, n) 中的随机数
+size_t rand_below(size_t n) {
+    return n ? (((uint64_t)next_rand() << 32) | next_rand()) % n : 0;
+}
+
+// 插入用的片段：两个分析器最可能处理得不一样的地方
+#define FRAG(s) { s, sizeof(s) - 1 }
+const struct {
+    const char *s;
+    size_t n;
+} frags[] = {
+    FRAG("["), FRAG("]"), FRAG("{"), FRAG("}"), FRAG("\""), FRAG(":"),
+    FRAG(":="), FRAG("<>"), FRAG("<="), FRAG(">="), FRAG("."), FRAG("="),
+    FRAG("\r"), FRAG("\t"), FRAG("\n"), FRAG("\0"), FRAG("\xe4\xb8\xad"), FRAG("\xff"),
+    FRAG("@"), FRAG("$"), FRAG("#"), FRAG("~"), FRAG("\x7f"), FRAG("\x01"),
+    FRAG("var"), FRAG("writeln"), FRAG("procedure"), FRAG("12abc"), FRAG("0"), FRAG("007"),
+    FRAG("{ x }"), FRAG("\"\""), FRAG("{}"), FRAG("\" s }"), FRAG("{ \" }"),
+};
+
+typedef struct {
+    char *p;
+    size_t len, cap;
+} Buf;
+
+void buf_reserve(Buf *b, size_t need) {
+    if (need <= b->cap) return;
+    size_t cap = b->cap ? b->cap : 4096;
+    while (cap < need) cap *= 2;
+    char *p = realloc(b->p, cap);
+    if (!p) out_of_memory();
+    b->p = p;
+    b->cap = cap;
+}
+
+// 在 pos 处插入 n 字节
+void buf_insert(Buf *b, size_t pos, const char *s, size_t n) {
+    buf_reserve(b, b->len + n + 2);
+    memmove(b->p + pos + n, b->p + pos, b->len - pos);
+    memcpy(b->p + pos, s, n);
+    b->len += n;
+}
+
+// 超长标识符 / 数字 / 字符串 / 注释
+void insert_long(Buf *b, size_t pos) {
+    static char tmp[4096];
+    size_t n = 40 + rand_below(3000);
+    switch (next_rand() % 4) {
+        case 0:
+            memset(tmp, 'a', n);
+            break;
+        case 1:
+            memset(tmp, '7', n);
+            break;
+        case 2:
+            memset(tmp, 'q', n);
+            tmp[0] = tmp[n - 1] = '"';
+            break;
+        default:
+            memset(tmp, ' ', n);
+            tmp[0] = '{';
+            tmp[n - 1] = '}';
+            break;
+    }
+    buf_insert(b, pos, tmp, n);
+}
+
+void mutate(Buf *b) {
+    for (size_t ops = 1 + rand_below(8); ops > 0; ops--) {
+        size_t pos = rand_below(b->len + 1);
+        unsigned r = next_rand() % 100;
+        if (r < 45) {
+            size_t k = rand_below(sizeof(frags) / sizeof(frags[0]));
+            buf_insert(b, pos, frags[k].s, frags[k].n);
+        } else if (r < 55) {
+            insert_long(b, pos);
+        } else if (r < 70) {
+            // 删除一段
+            size_t n = 1 + rand_below(32);
+            if (n > b->len - pos) n = b->len - pos;
+            memmove(b->p + pos, b->p + pos + n, b->len - pos - n);
+            b->len -= n;
+        } else if (r < 85) {
+            // 重复一段
+            size_t n = 1 + rand_below(64);
+            if (n > b->len - pos) n = b->len - pos;
+            buf_reserve(b, b->len + n + 2);
+            memmove(b->p + pos + n, b->p + pos, b->len - pos);
+            b->len += n;
+        } else if (pos < b->len) {
+            // 改写一个字节
+            b->p[pos] = (char)rand_below(256);
+        }
+    }
+}
+
+//=========================
+//     主程序
+//=========================
+int diff_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "Cannot open file: %s\n", path);
+        return -1;
+    }
+    Buf b = { NULL, 0, 0 };
+    buf_reserve(&b, 4096);
+    size_t n;
+    while ((n = fread(b.p + b.len, 1, b.cap - b.len, fp)) > 0) {
+        b.len += n;
+        buf_reserve(&b, b.len + 4096);
+    }
+    fclose(fp);
+    b.p[b.len] = '\0';
+    diff_one(path, b.p, b.len);
+    free(b.p);
+    return 0;
+}
+
+void print_total(const char *who, const Total *t) {
+    printf("    %-8s %12zu %12llu %10.1f %10.1f\n", who, t->bytes, t->ntokens,
+           t->bytes / t->sec / 1e6, t->ntokens / t->sec / 1e6);
+}
+
+int main(int argc, char *argv[]) {
+    double mb = 4;
+    size_t nmut = 2000, cut = 2048;
+    unsigned long long seed = 1;
+    int nfiles = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            mb = atof(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+            nmut = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            cut = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-v") == 0 && i + 1 < argc)
+            verbose = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+            dump_prefix = argv[++i];
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [-n MB] [-k count] [-c bytes] [-s seed] [-v reports] [-w prefix] [file...]\n",
+                    argv[0]);
+            return 2;
+        } else {
+            if (diff_file(argv[i]) != 0) return 2;
+            nfiles++;
+        }
+    }
+
+    if (nfiles == 0) {
+        if (mb <= 0 || cut == 0) {
+            fprintf(stderr, "bad size\n");
+            return 2;
+        }
+        size_t size = (size_t)(mb * 1e6);
+        if (size < cut) size = cut;
+
+        // 1. 整块生成语料，同时留作变异的素材
+        char *corpus[CORPUS_NMIX];
+        size_t corpus_len[CORPUS_NMIX];
+        for (int mix = 0; mix < CORPUS_NMIX; mix++) {
+            corpus[mix] = corpus_generate(mix, size, seed, &corpus_len[mix]);
+            if (!corpus[mix]) out_of_memory();
+            size_t bad = nbad;
+            diff_one(corpus_mix_name(mix), corpus[mix], corpus_len[mix]);
+            printf("corpus %-8s %8.2f MB  %s\n", corpus_mix_name(mix), corpus_len[mix] / 1e6,
+                   nbad > bad ? "DIFFER" : "ok");
+        }
+
+        // 2. 变异输入
+        rng = seed ? seed : 88172645463325252ULL;
+        Buf b = { NULL, 0, 0 };
+        size_t bad_before = nbad;
+        for (size_t k = 0; k < nmut; k++) {
+            int mix = k % CORPUS_NMIX;
+            size_t n = cut < corpus_len[mix] ? cut : corpus_len[mix];
+            size_t off = rand_below(corpus_len[mix] - n + 1);
+            buf_reserve(&b, n + 2);
+            memcpy(b.p, corpus[mix] + off, n);
+            b.len = n;
+            mutate(&b);
+            b.p[b.len] = '\0';        // pl0_lexer_open_mem 要求
+
+            char name[64];
+            snprintf(name, sizeof(name), "mutant %zu", k);
+            if (diff_one(name, b.p, b.len) && dump_prefix) {
+                char path[1024];
+                snprintf(path, sizeof(path), "%s%zu.pl0", dump_prefix, k);
+                FILE *fp = fopen(path, "wb");
+                if (!fp || fwrite(b.p, 1, b.len, fp) != b.len || fclose(fp) != 0)
+                    fprintf(stderr, "Cannot write file: %s\n", path);
+            }
+        }
+        printf("mutants %zu, %zu differ\n", nmut, nbad - bad_before);
+        free(b.p);
+        for (int mix = 0; mix < CORPUS_NMIX; mix++) free(corpus[mix]);
+    }
+
+    // 汇总
+    printf("\n%zu inputs, %zu differ\n", ninputs, nbad);
+    if (nkinds > 0) {
+        printf("first divergence by side and token kind (manual, side; -1 = no token):\n");
+        for (int i = 0; i < nkinds; i++)
+            printf("    %-7s (%3d, %3d) %8zu   e.g. %s\n", kinds[i].side, kinds[i].man, kinds[i].flex,
+                   kinds[i].count, kinds[i].example);
+    }
+    printf("\nthroughput (lex + format to memory):\n");
+    printf("    %-8s %12s %12s %10s %10s\n", "lexer", "bytes", "tokens", "MB/s", "Mtok/s");
+    print_total("manual", &man_total);
+    print_total("flex", &flex_total);
+    print_total("flex-r", &flex_r_total);
+
+    free(locs);
+    free(scan_buf);
+    return nbad ? 1 : 0;
+}
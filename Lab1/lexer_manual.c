@@ -1,344 +1,926 @@
+// 编译: gcc -O2 -pthread lexer_manual.c pl0lex.c lex_simd.c intern.c tokbin.c tokvar.c tokwriter.c -o lexer_manual
+// 用法: lexer_manual [-b | -z] [-s] [-t] [-u] [-j N] [-p 文件] [源文件]
+//       lexer_manual -m [-b | -z] [-s] [-t] [-u] [-j N] [-p 文件] [-o 目录] 文件|目录|@列表...
+//     -b 输出二进制 token 流（见 tokbin.h），标识符和字符串带符号 ID
+//     -z 输出压缩 token 流（见 tokvar.h），用于存档，比文本小得多；单线程时边分析边写出
+//     -t 按原来的长度上限截断过长的标识符、数字和字符串
+//     -u 输入须为合法的 UTF-8，否则报告第一处错误的位置并拒绝整个文件（流式输入拒绝其余部分）；
+//        注释、字符串外的非 ASCII 字符每个字符报一个错误，而不是每个字节一个
+//     -s 在标准错误输出驻留表统计
+//     -j 用 N 个线程并行分析（0 表示 CPU 核数），只对能 mmap 的普通文件生效
+//     -m 批量分析多个文件，-j 个线程同时分析不同的文件。目录递归收集其中的 .pl0，
+//        @列表 为每行一个路径的文件（@- 为标准输入）
+//     -o 批量分析时每个文件单独输出到该目录下（.tok / .tbin / .tvar）；
+//        不给 -o 时必须加 -b，全部文件写成一个带文件分隔的二进制流
+//     -p 分析结束后把分析器的计数器以 JSON 写到该文件（- 为标准错误输出）：各种别的 token 数与
+//        平均词素长度、各 DFA 状态读过的字节数与抽样的周期数、各类出错 token 数。
+//        -j 时各块末尾改写成哨兵的换行不计入字节数。
+//        需要用 -DPL0_LEX_STATS 编译，不定义时分析器中没有计数代码:
+//            gcc -O2 -pthread -DPL0_LEX_STATS lexer_manual.c pl0lex.c ... -o lexer_manual_stats
+
 #include <stdio.h>
-#include <ctype.h>
+#include <stdlib.h>
 #include <string.h>
-
-#define MAX_ID_LEN  50
-#define MAX_NUM_LEN 50
-#define MAX_STR_LEN 200
-
-// token types
-enum {
-    SYM_NULL = 0,            // 空
-    SYM_IDENTIFIER = 1,      // 标识符
-    SYM_NUMBER = 2,          // 整数
-
-    SYM_PLUS = 3,            // +
-    SYM_MINUS = 4,           // -
-    SYM_TIMES = 5,           // *
-    SYM_SLASH = 6,           // /
-    SYM_EQU = 7,             // =
-    SYM_GTR = 8,             // >
-    SYM_LES = 9,             // <
-    SYM_NEQ = 10,            // <>
-    SYM_LEQ = 11,            // <=
-    SYM_GEQ = 12,            // >=
-
-    SYM_LPAREN = 13,         // (
-    SYM_RPAREN = 14,         // )
-    SYM_LBRACE = 15,         // {
-    SYM_RBRACE = 16,         // }
-    SYM_SEMICOLON = 17,      // ;
-    SYM_COMMA = 18,          // , 
-    SYM_ASSIGN = 20,         // :=
-
-    SYM_VAR = 21,            // var
-    SYM_IF = 22,             // if
-    SYM_THEN = 23,           // then
-    SYM_ELSE = 24,           // else
-    SYM_WHILE = 25,          // while
-    SYM_FOR = 26,            // for
-    SYM_BEGIN = 27,          // begin
-    SYM_WRITELN = 28,        // writeln
-    SYM_PROCEDURE = 29,      // procedure
-    SYM_END = 30,            // end
-
-    SYM_CONST = 31,          // const
-    SYM_CALL = 32,           // call
-    SYM_DO = 33,             // do
-    SYM_WRITE = 34,          // write
-    SYM_PERIOD = 35,         // .
-    SYM_STRING = 36,         // "string"
-
-    SYM_LBRACKET = 37,       // [
-    SYM_RBRACKET = 38,       // ]
-
-    SYM_ERROR = 100          // 出错
-};
-
-// state types
-typedef enum {
-    STATE_START,
-    STATE_INID,        // 标识符状态
-    STATE_INNUM,       // 数字状态  
-    STATE_INASSIGN,    // 遇到 :
-    STATE_INCOMMENT,   // 注释状态
-    STATE_INSTRING,    // 字符串状态（你原来的 STATE_INCHAR 改名更准确）
-    STATE_DONE,        // 完成状态
-    STATE_ERROR        // 出错状态
-} DFA_State;
-
-FILE *fin;
-int ch;
-
-// 读取下一个字符
-void getch() {
-    ch = fgetc(fin);
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "pl0lex.h"
+#include "tokbin.h"
+#include "tokvar.h"
+#include "tokwriter.h"
+
+#define BATCH_SIZE 256      // 每次从词法分析器取出的 token 数
+
+// 并行分析的分块大小：每个线程约分到 CHUNKS_PER_THREAD 块，便于负载均衡
+#define CHUNKS_PER_THREAD 8
+#define CHUNK_MIN  (256 * 1024)
+#define CHUNK_MAX  (8 * 1024 * 1024)
+#define OUT_WINDOW 4        // 文本输出时，每个线程最多领先已写出的块数
+
+int out_binary = 0;             // 1: 输出二进制 token 流（-z 时也置 1，先收集成 tokbin 再转换）
+int out_varint = 0;             // 1: 输出压缩 token 流
+int show_stats = 0;             // 1: 输出驻留表统计
+int truncate_lex = 0;           // 1: 截断过长的词素（兼容原来的输出）
+int check_utf8 = 0;             // 1: 校验 UTF-8
+int nthreads = 1;               // 分析线程数
+const char *stats_path = NULL;  // -p：计数器的输出文件
+intern_table symtab;            // 标识符 / 字符串驻留表
+tokbin_writer tbw;
+tokvar_writer tvw;              // 单线程 -z 时直接写出
+tokwriter tw_out;               // 文本输出
+
+// 输出一批 token。-z 且 bw 为 NULL 时写到 tvw
+static void emit_tokens(tokwriter *tw, tokbin_writer *bw, const pl0_token *toks, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        const pl0_token *t = &toks[i];
+        if (out_varint && !bw) {
+            if (tokvar_put(&tvw, t->sym, t->text, pl0_print_len(t), t->loc, t->id, t->value) != 0) {
+                fprintf(stderr, "Write error\n");
+                exit(1);
+            }
+            continue;
+        }
+        if (out_binary) {
+            if (tokbin_put(bw, t->sym, t->text, pl0_print_len(t), t->loc, t->id, t->value) != 0) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+            continue;
+        }
+        tw_token(tw, t->sym, t->text, pl0_print_len(t));
+    }
 }
 
-// 判断保留字
-int check_reserved(const char *s) {
-    if (!strcmp(s, "var")) return SYM_VAR;
-    if (!strcmp(s, "if")) return SYM_IF;
-    if (!strcmp(s, "then")) return SYM_THEN;
-    if (!strcmp(s, "else")) return SYM_ELSE;
-    if (!strcmp(s, "while")) return SYM_WHILE;
-    if (!strcmp(s, "for")) return SYM_FOR;
-    if (!strcmp(s, "begin")) return SYM_BEGIN;
-    if (!strcmp(s, "writeln")) return SYM_WRITELN;
-    if (!strcmp(s, "procedure")) return SYM_PROCEDURE;
-    if (!strcmp(s, "end")) return SYM_END;
-
-    if (!strcmp(s, "const")) return SYM_CONST;
-    if (!strcmp(s, "call")) return SYM_CALL;
-    if (!strcmp(s, "do")) return SYM_DO;
-    if (!strcmp(s, "write")) return SYM_WRITE;
-    return 0;
+static void report_utf8(const char *path, pl0_loc loc) {
+    fprintf(stderr, "Invalid UTF-8 in %s at line %u, column %u\n", path, PL0_LINE(loc), PL0_COL(loc));
 }
 
-// 输出 token
-void print_token(int sym, const char *text) {
-    if (sym == SYM_IDENTIFIER)
-        printf("(1, \"%s\")\n", text);
-    else if (sym == SYM_NUMBER)
-        printf("(2, %s)\n", text);
-    else if (sym == SYM_STRING)
-        printf("(36, \"%s\")\n", text);
-    else if (sym == SYM_ERROR)
-        printf("(100, \"%s\")\n", text);
+// 分析器出错的提示：UTF-8 不合法，或内存不足
+static void report_lex_error(const char *path, const pl0_lexer *lx) {
+    if (pl0_lexer_error(lx) == PL0_LEX_EUTF8)
+        report_utf8(path, pl0_lexer_error_loc(lx));
     else
-        printf("(%d, \"%s\")\n", sym, text);
+        fprintf(stderr, "Out of memory\n");
 }
 
-int getsym() {
-    DFA_State state = STATE_START;
-    char buf[MAX_STR_LEN] = {0};
-    int k = 0;
+//=========================
+//     计数器（-p）
+//=========================
+#ifdef PL0_LEX_STATS
+pl0_lex_stats lex_stats;        // 各分析器的计数之和
+pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// 关闭分析器之前调用，各线程的分析器都累加到 lex_stats
+static void collect_stats(const pl0_lexer *lx) {
+    pthread_mutex_lock(&stats_lock);
+    pl0_lexer_add_stats(lx, &lex_stats);
+    pthread_mutex_unlock(&stats_lock);
+}
 
-    while (state != STATE_DONE && state != STATE_ERROR) {
+static double ratio(uint64_t a, uint64_t b) {
+    return b ? (double)a / b : 0;
+}
 
-        switch (state) {
+// 把 lex_stats 写成 JSON，失败返回 -1
+static int write_stats(const char *path) {
+    const pl0_lex_stats *st = &lex_stats;
+    FILE *fp = strcmp(path, "-") == 0 ? stderr : fopen(path, "w");
+    if (!fp) return -1;
 
-            //=========================
-            //     初始状态
-            //=========================
-            case STATE_START:
+    uint64_t ntok = 0, nbytes = 0, lexeme = 0, nerr = 0, cycles = 0;
+    for (int i = 0; i < PL0_LEX_NSYMS; i++) {
+        ntok += st->tokens[i];
+        lexeme += st->lexeme_bytes[i];
+    }
+    for (int i = 0; i < PL0_LEX_NSTATES; i++) {
+        nbytes += st->state_bytes[i];
+        cycles += st->state_cycles[i];
+    }
+    for (int i = 0; i < PL0_LEX_ERR_COUNT; i++) nerr += st->errors[i];
+
+    fprintf(fp, "{\n  \"bytes\": %llu,\n  \"tokens\": %llu,\n  \"avg_lexeme_len\": %.3f,\n",
+            (unsigned long long)nbytes, (unsigned long long)ntok, ratio(lexeme, ntok));
+
+    // 只列出出现过的种别，键为种别码
+    fprintf(fp, "  \"syms\": {");
+    const char *sep = "\n";
+    for (int i = 0; i < PL0_LEX_NSYMS; i++) {
+        if (!st->tokens[i]) continue;
+        fprintf(fp, "%s    \"%d\": {\"count\": %llu, \"avg_len\": %.3f}", sep, i,
+                (unsigned long long)st->tokens[i], ratio(st->lexeme_bytes[i], st->tokens[i]));
+        sep = ",\n";
+    }
+    fprintf(fp, "\n  },\n");
+
+    // 周期数只来自抽样的 token，按抽样中的进入次数、字节数折算；没有 TSC 的平台不输出。
+    // 每次进入状态都含一次读 TSC 的开销（几十个周期），短状态偏高，只宜比较相对大小
+    fprintf(fp, "  \"sample_every\": %d,\n  \"sampled_tokens\": %llu,\n  \"states\": {",
+            PL0_LEX_SAMPLE, (unsigned long long)st->sampled_tokens);
+    sep = "\n";
+    for (int i = 0; i < PL0_LEX_NSTATES; i++) {
+        if (!st->state_visits[i]) continue;
+        fprintf(fp, "%s    \"%s\": {\"visits\": %llu, \"bytes\": %llu, \"byte_share\": %.4f", sep,
+                pl0_lex_state_name(i), (unsigned long long)st->state_visits[i],
+                (unsigned long long)st->state_bytes[i], ratio(st->state_bytes[i], nbytes));
+        if (cycles)
+            fprintf(fp, ", \"sampled_cycles\": %llu, \"cycle_share\": %.4f, "
+                        "\"cycles_per_visit\": %.1f, \"cycles_per_byte\": %.3f",
+                    (unsigned long long)st->state_cycles[i], ratio(st->state_cycles[i], cycles),
+                    ratio(st->state_cycles[i], st->state_sampled_visits[i]),
+                    ratio(st->state_cycles[i], st->state_sampled_bytes[i]));
+        fprintf(fp, "}");
+        sep = ",\n";
+    }
+    fprintf(fp, "\n  },\n");
 
-                // 空白
-                while (isspace(ch)) getch();
+    fprintf(fp, "  \"errors\": {\n    \"total\": %llu", (unsigned long long)nerr);
+    for (int i = 0; i < PL0_LEX_ERR_COUNT; i++)
+        fprintf(fp, ",\n    \"%s\": %llu", pl0_lex_error_name(i), (unsigned long long)st->errors[i]);
+    fprintf(fp, "\n  }\n}\n");
 
-                // 标识符
-                if (isalpha(ch)) {
-                    state = STATE_INID;
-                    buf[k++] = ch;
-                    getch();
-                    break;
-                }
+    int err = ferror(fp);
+    if (fp != stderr && fclose(fp) != 0) err = 1;
+    return err ? -1 : 0;
+}
 
-                // 数字
-                if (isdigit(ch)) {
-                    state = STATE_INNUM;
-                    buf[k++] = ch;
-                    getch();
-                    break;
-                }
+// 给了 -p 时写出计数器，失败返回 -1
+static int dump_stats(void) {
+    if (!stats_path || write_stats(stats_path) == 0) return 0;
+    fprintf(stderr, "Cannot write: %s\n", stats_path);
+    return -1;
+}
+#else
+#define collect_stats(lx) ((void)0)
+#define dump_stats() 0
+#endif
+
+// 分析到输入结束，出错返回 -1
+static int lex_all(pl0_lexer *lx, tokwriter *tw, tokbin_writer *bw) {
+    pl0_token toks[BATCH_SIZE];
+    size_t n;
+    while ((n = pl0_lex_batch(lx, toks, BATCH_SIZE)) > 0)
+        emit_tokens(tw, bw, toks, n);
+    return pl0_lexer_error(lx) ? -1 : 0;
+}
 
-                // :=
-                if (ch == ':') {
-                    state = STATE_INASSIGN;
-                    buf[k++] = ':';
-                    getch();
-                    break;
-                }
+// 把收集好的 n 段二进制结果写到 fp：-b 写 tokbin，-z 转成压缩流。失败返回 -1
+static int write_parts(tokbin_writer *parts, size_t n, FILE *fp) {
+    if (!out_varint) return n == 1 ? tokbin_write(parts, fp) : tokbin_write_parts(parts, n, fp);
+
+    tokvar_writer vw;
+    int err = tokvar_writer_init(&vw, fp);
+    for (size_t i = 0; i < n && !err; i++) {
+        const tokbin_writer *w = &parts[i];
+        for (uint32_t k = 0; k < w->ntokens && !err; k++) {
+            const tokbin_rec *r = &w->recs[k];
+            err = tokvar_put(&vw, r->kind, w->strtab + r->offset, r->length, r->loc, r->id, r->value);
+        }
+    }
+    return tokvar_writer_close(&vw) != 0 || err ? -1 : 0;
+}
 
-                // 注释 { ... }
-                if (ch == '{') {
-                    state = STATE_INCOMMENT;
-                    getch(); // 跳过 {
-                    break;
-                }
+//=========================
+//     并行分析
+//=========================
+// 注释和字符串都不能跨行，每个换行之后必然回到初始状态，
+// 所以在换行处切开的各块可以独立分析，结果按顺序拼接即与整体分析相同。
+// 块末的换行改写为 '\0' 作为哨兵：对前一个 token 而言，换行与输入结束的作用完全一样
+typedef struct {
+    char *start;
+    size_t len;
+    int cut;                    // 1: 块末的换行已改写为哨兵
+    tokwriter tw;               // 文本输出（内存）
+    tokbin_writer bw;           // 二进制输出
+    intern_table syms;          // 块内驻留表，合并时映射到全局 ID
+    uint32_t nlines;            // 块内换行数
+    int done;
+    int error;
+} chunk_job;
+
+chunk_job *jobs;
+size_t njobs;
+size_t next_job;                // 下一个待领取的块，原子递增
+size_t nwritten;                // 已写出的块数
+pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;
+
+static void lex_chunk(chunk_job *job) {
+    pl0_lexer *lx = pl0_lexer_open_mem(job->start, job->len);
+    if (!lx) {
+        job->error = 1;
+        return;
+    }
+    pl0_lexer_set_truncate(lx, truncate_lex);
+    // 整个文件已经校验过，这里只打开按字符报错的模式，不再逐块校验
+    pl0_lexer_set_utf8_trusted(lx, check_utf8);
+    if (out_binary || show_stats) {
+        if (intern_init(&job->syms) != 0) {
+            job->error = 1;
+            pl0_lexer_close(lx);
+            return;
+        }
+        pl0_lexer_set_intern(lx, &job->syms);
+    }
+    tokbin_writer_init(&job->bw);
+    // 文本输出大约是源文件的两倍
+    if (!out_binary && tw_init_mem(&job->tw, job->len * 2) != 0) {
+        job->error = 1;
+        pl0_lexer_close(lx);
+        return;
+    }
 
-                // 字符串
-                if (ch == '"') {
-                    state = STATE_INSTRING;
-                    getch(); // 跳过开头 "
-                    break;
-                }
+    if (lex_all(lx, &job->tw, &job->bw) != 0 || job->tw.error) job->error = 1;
+    job->nlines = pl0_lexer_line(lx) - 1 + job->cut;
+    collect_stats(lx);
+    pl0_lexer_close(lx);
+}
 
-                // EOF
-                if (ch == EOF) return SYM_NULL;
-
-                // <, <=, <>
-                if (ch == '<') {
-                    getch();
-                    if (ch == '=') {
-                        getch();
-                        print_token(SYM_LEQ, "<=");
-                        return SYM_LEQ;
-                    }
-                    if (ch == '>') {
-                        getch();
-                        print_token(SYM_NEQ, "<>");
-                        return SYM_NEQ;
-                    }
-                    print_token(SYM_LES, "<");
-                    return SYM_LES;
-                }
-    
-                // >, >=
-                if (ch == '>') {
-                    getch();
-                    if (ch == '=') {
-                        getch();
-                        print_token(SYM_GEQ, ">=");
-                        return SYM_GEQ;
-                    }
-                    print_token(SYM_GTR, ">");
-                    return SYM_GTR;
-                }
+static void *lex_worker(void *arg) {
+    size_t window = (size_t)OUT_WINDOW * nthreads;
+    (void)arg;
 
-                // 单字符符号 + 错误符号
-                int cur = ch;
-                getch();
-
-                // 单字符符号
-                {
-                    switch (cur) {
-                        case '+': print_token(SYM_PLUS, "+"); return SYM_PLUS;
-                        case '-': print_token(SYM_MINUS, "-"); return SYM_MINUS;
-                        case '*': print_token(SYM_TIMES, "*"); return SYM_TIMES;
-                        case '/': print_token(SYM_SLASH, "/"); return SYM_SLASH;
-                        case '(': print_token(SYM_LPAREN, "("); return SYM_LPAREN;
-                        case ')': print_token(SYM_RPAREN, ")"); return SYM_RPAREN;
-                        case ';': print_token(SYM_SEMICOLON, ";"); return SYM_SEMICOLON;
-                        case '[': print_token(SYM_LBRACKET, "["); return SYM_LBRACKET;
-                        case ']': print_token(SYM_RBRACKET, "]"); return SYM_RBRACKET;
-                        case '=': print_token(SYM_EQU, "="); return SYM_EQU;
-                        case ',': print_token(SYM_COMMA, ","); return SYM_COMMA;
-                        case '.': print_token(SYM_PERIOD, "."); return SYM_PERIOD;
-                    }
-                }
+    for (;;) {
+        size_t i = __atomic_fetch_add(&next_job, 1, __ATOMIC_RELAXED);
+        if (i >= njobs) break;
 
-                // 错误符号
-                {   // 非法字符 —— 使用 cur（原始字符）
-                    char illegal[2];
-                    illegal[0] = (char)cur;
-                    illegal[1] = '\0';
-                    print_token(SYM_ERROR, illegal);
-                    return SYM_ERROR;
-                }
+        // 文本输出边分析边写出，不要领先太多，控制内存占用
+        if (!out_binary) {
+            pthread_mutex_lock(&job_lock);
+            while (i >= nwritten + window) pthread_cond_wait(&job_cond, &job_lock);
+            pthread_mutex_unlock(&job_lock);
+        }
 
+        lex_chunk(&jobs[i]);
 
-            //=========================
-            //     标识符状态
-            //=========================
-            case STATE_INID:
-                while (isalnum(ch) && k < MAX_ID_LEN - 1) {
-                    buf[k++] = ch;
-                    getch();
-                }
-                buf[k] = '\0';
-                {
-                    int reserved = check_reserved(buf);
-                    if (reserved) {
-                        print_token(reserved, buf);
-                        return reserved;
-                    }
-                    print_token(SYM_IDENTIFIER, buf);
-                    return SYM_IDENTIFIER;
-                }
+        pthread_mutex_lock(&job_lock);
+        jobs[i].done = 1;
+        pthread_cond_broadcast(&job_cond);
+        pthread_mutex_unlock(&job_lock);
+    }
+    return NULL;
+}
 
-            //=========================
-            //     数字状态
-            //=========================
-            case STATE_INNUM:
-                while (isdigit(ch) && k < MAX_NUM_LEN - 1) {
-                    buf[k++] = ch;
-                    getch();
-                }
-                // 数字后接字母 -> 错误
-                if (isalpha(ch)) {
-                    while (isalnum(ch) && k < MAX_NUM_LEN - 1) {
-                        buf[k++] = ch;
-                        getch();
-                    }
-                    buf[k] = '\0';
-                    print_token(SYM_ERROR, buf);
-                    return SYM_ERROR;
-                }
-                buf[k] = '\0';
-                print_token(SYM_NUMBER, buf);
-                return SYM_NUMBER;
-
-            //=========================
-            //     :=
-            //=========================
-            case STATE_INASSIGN:
-                if (ch == '=') {
-                    getch();
-                    print_token(SYM_ASSIGN, ":=");
-                    return SYM_ASSIGN;
-                }
-                buf[k] = '\0';
-                print_token(SYM_ERROR, buf);
-                return SYM_ERROR;
-            
-            //=========================
-            //     注释 { ... }
-            //=========================
-            case STATE_INCOMMENT:
-                while (ch != '}' && ch != EOF && ch != '\n') {
-                    getch();
-                }
-                if (ch != '}') {
-                    print_token(SYM_ERROR, "=== Unclosed comment ===");
-                    return SYM_ERROR;
-                }
-                getch(); // 跳过 }
-                state = STATE_START;
-                break;
+// 把 [base, base + size) 在换行处切成块
+static int split_chunks(char *base, size_t size) {
+    size_t chunk = size / ((size_t)nthreads * CHUNKS_PER_THREAD);
+    if (chunk < CHUNK_MIN) chunk = CHUNK_MIN;
+    if (chunk > CHUNK_MAX) chunk = CHUNK_MAX;
+
+    jobs = calloc(size / chunk + 1, sizeof(chunk_job));
+    if (!jobs) return -1;
+
+    char *p = base, *end = base + size;
+    while (p < end) {
+        chunk_job *job = &jobs[njobs++];
+        job->start = p;
+        char *nl = NULL;
+        if ((size_t)(end - p) > chunk) nl = memchr(p + chunk - 1, '\n', end - (p + chunk - 1));
+        if (nl && nl + 1 < end) {
+            *nl = '\0';
+            job->len = nl - p;
+            job->cut = 1;
+            p = nl + 1;
+        } else {
+            job->len = end - p;     // 最后一块，映射区末尾本来就有哨兵
+            p = end;
+        }
+    }
+    return 0;
+}
 
-            //=========================
-            //     字符串
-            //=========================
-            case STATE_INSTRING:
-                while (ch != '"' && ch != EOF && ch != '\n' && k < MAX_STR_LEN - 1) {
-                    buf[k++] = ch;
-                    getch();
-                }
-                if (ch != '"') {    // 未闭合
-                    print_token(SYM_ERROR, "=== Unclosed string ===");
-                    return SYM_ERROR;
-                }
-                getch(); // 跳过 "
-                buf[k] = '\0';
-                print_token(SYM_STRING, buf);
-                return SYM_STRING;
+// 把块内驻留表按顺序并入全局表。ID 按首次出现的顺序分配，
+// 所以得到的全局 ID 与单线程分析完全相同。返回 块内 ID -> 全局 ID 的映射
+static uint32_t *merge_symbols(const intern_table *syms) {
+    uint32_t *map = malloc(((size_t)syms->nsyms + 1) * sizeof(uint32_t));
+    if (!map) return NULL;
+    map[0] = 0;
+    for (uint32_t id = 1; id <= syms->nsyms; id++) {
+        map[id] = intern(&symtab, intern_str(syms, id), intern_len(syms, id));
+        if (!map[id]) {
+            free(map);
+            return NULL;
+        }
+    }
+    return map;
+}
+
+// 偏移 off 处的行、列号，只在报错时用
+static pl0_loc offset_loc(const char *base, size_t off) {
+    uint32_t line = 1;
+    size_t line_start = 0;
+    for (size_t i = 0; i < off; i++)
+        if (base[i] == '\n') {
+            line++;
+            line_start = i + 1;
+        }
+    return PL0_LOC(line, off - line_start + 1);
+}
+
+// 返回 0 成功，1 输入无法映射或建不了线程（改用单线程），-1 出错
+static int lex_parallel(const char *path) {
+    FILE *in = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    if (!in) return 1;
+    size_t size, map_len;
+    char *base = pl0_map_fd(fileno(in), &size, &map_len);
+    if (in != stdin) fclose(in);
+    if (!base) return 1;
+
+    // 切块之前整体校验，不合法时一个 token 也不输出
+    size_t bad = check_utf8 ? pl0_utf8_check(base, size) : size;
+    if (bad < size) {
+        report_utf8(path, offset_loc(base, bad));
+        pl0_unmap(base, map_len);
+        return -1;
+    }
+
+    int ret = 0;
+    if (split_chunks(base, size) != 0) {
+        pl0_unmap(base, map_len);
+        return -1;
+    }
+
+    pthread_t *tids = malloc(nthreads * sizeof(pthread_t));
+    int started = 0;
+    if (tids) {
+        while (started < nthreads && pthread_create(&tids[started], NULL, lex_worker, NULL) == 0)
+            started++;
+    }
+    if (started == 0) {
+        // 一个线程也建不了：改用单线程。不能在当前线程里跑 lex_worker，
+        // 文本输出时它要等写出方推进 nwritten，而写出方就是当前线程
+        free(tids);
+        free(jobs);
+        jobs = NULL;
+        njobs = 0;
+        pl0_unmap(base, map_len);
+        return 1;
+    }
+
+    // 文本输出：按块的顺序等待并写出
+    for (size_t i = 0; i < njobs && !out_binary; i++) {
+        pthread_mutex_lock(&job_lock);
+        while (!jobs[i].done) pthread_cond_wait(&job_cond, &job_lock);
+        pthread_mutex_unlock(&job_lock);
+
+        if (jobs[i].error || tw_write_to(&jobs[i].tw, STDOUT_FILENO) != 0) ret = -1;
+        tw_close(&jobs[i].tw);
+
+        pthread_mutex_lock(&job_lock);
+        nwritten++;
+        pthread_cond_broadcast(&job_cond);
+        pthread_mutex_unlock(&job_lock);
+    }
+
+    for (int t = 0; t < started; t++) pthread_join(tids[t], NULL);
+    free(tids);
+
+    // 符号 ID 与行号改为全局的；二进制输出再把各块首尾相接写出
+    uint32_t line_base = 0;
+    unsigned long long lookups = 0, probes = 0;
+    tokbin_writer *parts = malloc(njobs * sizeof(tokbin_writer));
+    if (!parts) ret = -1;
+    for (size_t i = 0; i < njobs; i++) {
+        chunk_job *job = &jobs[i];
+        if (job->error) ret = -1;
+        if (ret == 0 && (out_binary || show_stats)) {
+            uint32_t *map = merge_symbols(&job->syms);
+            if (!map) ret = -1;
+            for (uint32_t k = 0; map && k < job->bw.ntokens; k++) {
+                job->bw.recs[k].id = map[job->bw.recs[k].id];
+                job->bw.recs[k].loc += PL0_LOC(line_base, 0);
+            }
+            free(map);
+        }
+        line_base += job->nlines;
+        lookups += job->syms.lookups;
+        probes += job->syms.probes;
+        if (parts) parts[i] = job->bw;
+        intern_free(&job->syms);
+    }
+    // 统计中报告分析时的查找次数，而不是合并时的
+    symtab.lookups = lookups;
+    symtab.probes = probes;
+
+    if (out_binary && ret == 0 && write_parts(parts, njobs, stdout) != 0) {
+        fprintf(stderr, "Write error\n");
+        ret = -1;
+    }
+    for (size_t i = 0; i < njobs; i++) tokbin_writer_free(&jobs[i].bw);
+    free(parts);
+    free(jobs);
+    pl0_unmap(base, map_len);
+    return ret;
+}
 
-            default:
-                state = STATE_ERROR;
+
+//=========================
+//     批量分析
+//=========================
+// -m：一个进程分析许多文件，省去每个文件启动一次进程的开销。
+// 文件按输入顺序编号，开始时把编号区间平均分给各线程；线程先从自己区间的头部领取，
+// 做完后从别的线程的区间尾部偷走一半（work stealing），小文件多、大小不均时也能分匀。
+// -o DIR 时每个文件单独输出到 DIR 下与源文件同名的路径（加 .tok / .tbin 后缀）；
+// 否则按输入顺序写成一个合并的二进制流，每个文件一帧（见 tokbin.h），符号 ID 全局统一
+typedef struct {
+    pthread_mutex_t lock;
+    size_t lo, hi;              // 尚未领取的文件 [lo, hi)
+} work_range;
+
+typedef struct {
+    char *path;
+    tokbin_writer bw;           // 合并输出时等待按顺序写出的结果
+    intern_table syms;          // 文件内驻留表，合并时映射到全局 ID
+    int done;
+    int error;
+} file_job;
+
+int batch_mode = 0;             // 1: 批量分析
+const char *out_dir = NULL;     // 每个文件单独输出的目录
+file_job *files;
+size_t nfiles, files_cap;
+work_range *ranges;
+int nworkers;
+unsigned long long batch_tokens;    // 原子累加
+size_t batch_failed;
+
+static int add_input(const char *arg);
+
+static int add_file(const char *path) {
+    if (nfiles == files_cap) {
+        size_t cap = files_cap ? files_cap * 2 : 1024;
+        file_job *p = realloc(files, cap * sizeof(file_job));
+        if (!p) return -1;
+        files = p;
+        files_cap = cap;
+    }
+    file_job *f = &files[nfiles];
+    memset(f, 0, sizeof(*f));
+    if (!(f->path = strdup(path))) return -1;
+    nfiles++;
+    return 0;
+}
+
+static int cmp_name(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int has_suffix(const char *s, const char *suffix) {
+    size_t n = strlen(s), k = strlen(suffix);
+    return n >= k && strcmp(s + n - k, suffix) == 0;
+}
+
+// 递归收集目录下的 .pl0 文件。同一目录内按名字排序，顺序与文件系统无关
+static int add_dir(const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        fprintf(stderr, "Cannot open directory: %s\n", dir);
+        batch_failed++;
+        return 0;
+    }
+    char **names = NULL;
+    size_t n = 0, cap = 0;
+    int ret = 0;
+    struct dirent *e;
+    while (ret == 0 && (e = readdir(d)) != NULL) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) continue;
+        if (n == cap) {
+            cap = cap ? cap * 2 : 64;
+            char **p = realloc(names, cap * sizeof(char *));
+            if (!p) {
+                ret = -1;
                 break;
-        } // end switch
-    } // end while
+            }
+            names = p;
+        }
+        if (!(names[n] = strdup(e->d_name))) ret = -1;
+        else n++;
+    }
+    closedir(d);
+    qsort(names, n, sizeof(char *), cmp_name);
+
+    const char *sep = has_suffix(dir, "/") ? "" : "/";
+    for (size_t i = 0; i < n; i++) {
+        size_t len = strlen(dir) + strlen(names[i]) + 2;
+        char *path = ret == 0 ? malloc(len) : NULL;
+        if (path) {
+            snprintf(path, len, "%s%s%s", dir, sep, names[i]);
+            struct stat st;
+            // 指向目录的符号链接不跟进去，免得绕圈
+            if (lstat(path, &st) == 0 && S_ISDIR(st.st_mode))
+                ret = add_dir(path);
+            else if (has_suffix(names[i], ".pl0") && stat(path, &st) == 0 && S_ISREG(st.st_mode))
+                ret = add_file(path);
+        } else {
+            ret = -1;
+        }
+        free(path);
+        free(names[i]);
+    }
+    free(names);
+    return ret;
+}
+
+// 文件列表，每行一个路径（也可以是目录）；"-" 表示标准输入
+static int add_list(const char *list) {
+    FILE *fp = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+    if (!fp) {
+        fprintf(stderr, "Cannot open file: %s\n", list);
+        batch_failed++;
+        return 0;
+    }
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t n;
+    int ret = 0;
+    while (ret == 0 && (n = getline(&line, &cap, fp)) >= 0) {
+        while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r')) line[--n] = '\0';
+        if (n > 0) ret = add_input(line);
+    }
+    free(line);
+    if (fp != stdin) fclose(fp);
+    return ret;
+}
+
+// 参数：文件、目录，或 @列表文件。只有内存不足时返回 -1
+static int add_input(const char *arg) {
+    struct stat st;
+    if (arg[0] == '@') return add_list(arg + 1);
+    if (stat(arg, &st) == 0 && S_ISDIR(st.st_mode)) return add_dir(arg);
+    return add_file(arg);      // 打不开的文件在分析时报错
+}
+
+// out_dir 下与源文件对应的输出路径：去掉开头的 '/' 和路径中的 "."，".." 换成 "__"，
+// 再加后缀；中间的目录逐级创建。失败返回 NULL
+static char *make_out_path(const char *src) {
+    const char *suffix = out_varint ? ".tvar" : out_binary ? ".tbin" : ".tok";
+    size_t cap = strlen(out_dir) + strlen(src) + strlen(suffix) + 2;
+    char *out = malloc(cap);
+    if (!out) return NULL;
+    size_t n = strlen(out_dir);
+    memcpy(out, out_dir, n);
+
+    const char *p = src;
+    for (;;) {
+        while (*p == '/') p++;
+        if (!*p) break;
+        const char *e = strchr(p, '/');
+        if (!e) e = p + strlen(p);
+        size_t len = e - p;
+        if (len == 1 && p[0] == '.') {
+            p = e;
+            continue;
+        }
+        out[n++] = '/';
+        memcpy(out + n, (len == 2 && p[0] == '.' && p[1] == '.') ? "__" : p, len);
+        n += len;
+        p = e;
+        if (*p) {
+            out[n] = '\0';
+            if (mkdir(out, 0777) != 0 && errno != EEXIST) {
+                free(out);
+                return NULL;
+            }
+        }
+    }
+    strcpy(out + n, suffix);
+    return out;
+}
+
+// 单独输出：文本直接写到输出文件，二进制分析完再写出
+static int write_own_output(file_job *f, pl0_lexer *lx) {
+    char *out = make_out_path(f->path);
+    int fd = out ? open(out, O_WRONLY | O_CREAT | O_TRUNC, 0666) : -1;
+    if (fd < 0) {
+        fprintf(stderr, "Cannot write file: %s\n", out ? out : f->path);
+        free(out);
+        return -1;
+    }
+
+    int err = 0, lex_err = 0;
+    tokwriter tw;
+    if (out_binary) {
+        FILE *fp = NULL;
+        lex_err = lex_all(lx, NULL, &f->bw) != 0;
+        err = lex_err || !(fp = fdopen(fd, "wb")) || write_parts(&f->bw, 1, fp) != 0;
+        __atomic_add_fetch(&batch_tokens, f->bw.ntokens, __ATOMIC_RELAXED);
+        if (fp) fclose(fp);
+        else close(fd);
+    } else {
+        err = tw_init(&tw, fd) != 0 || (lex_err = lex_all(lx, &tw, NULL) != 0);
+        __atomic_add_fetch(&batch_tokens, tw.ntokens, __ATOMIC_RELAXED);
+        if (tw_close(&tw) != 0) err = 1;
+        close(fd);
+    }
+    if (lex_err)
+        report_lex_error(f->path, lx);
+    else if (err)
+        fprintf(stderr, "Write error: %s\n", out);
+    free(out);
+    return err ? -1 : 0;
+}
+
+static void lex_file(file_job *f) {
+    pl0_lexer *lx = pl0_lexer_open(f->path);
+    if (!lx) {
+        fprintf(stderr, "Cannot open file: %s\n", f->path);
+        f->error = 1;
+        return;
+    }
+    pl0_lexer_set_truncate(lx, truncate_lex);
+    pl0_lexer_set_utf8(lx, check_utf8);
+    tokbin_writer_init(&f->bw);
+    if (out_binary) {
+        if (intern_init(&f->syms) != 0) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        pl0_lexer_set_intern(lx, &f->syms);
+    }
+
+    if (out_dir) {
+        if (write_own_output(f, lx) != 0) f->error = 1;
+        tokbin_writer_free(&f->bw);
+        intern_free(&f->syms);
+    } else {
+        if (lex_all(lx, NULL, &f->bw) != 0) {
+            report_lex_error(f->path, lx);
+            f->error = 1;
+        }
+        __atomic_add_fetch(&batch_tokens, f->bw.ntokens, __ATOMIC_RELAXED);
+    }
+    collect_stats(lx);
+    pl0_lexer_close(lx);
+}
+
+// 领取下一个文件：先取自己区间的头部，取完了就从别的线程的区间尾部偷一半
+static int take_file(int self, size_t *idx) {
+    work_range *r = &ranges[self];
+    pthread_mutex_lock(&r->lock);
+    int ok = r->lo < r->hi;
+    if (ok) *idx = r->lo++;
+    pthread_mutex_unlock(&r->lock);
+    if (ok) return 1;
+
+    for (int k = 1; k < nworkers; k++) {
+        work_range *v = &ranges[(self + k) % nworkers];
+        pthread_mutex_lock(&v->lock);
+        size_t n = v->hi - v->lo;
+        size_t from = v->hi - (n + 1) / 2;
+        size_t to = v->hi;
+        v->hi = from;
+        pthread_mutex_unlock(&v->lock);
+        if (n == 0) continue;
+
+        // 偷到的第一个文件马上做，其余放进自己的区间，别人还可以再偷
+        pthread_mutex_lock(&r->lock);
+        r->lo = from + 1;
+        r->hi = to;
+        pthread_mutex_unlock(&r->lock);
+        *idx = from;
+        return 1;
+    }
+    return 0;
+}
+
+static void *batch_worker(void *arg) {
+    int self = (int)(intptr_t)arg;
+    size_t i;
+    while (take_file(self, &i)) {
+        lex_file(&files[i]);
+        if (files[i].error) __atomic_add_fetch(&batch_failed, 1, __ATOMIC_RELAXED);
+
+        pthread_mutex_lock(&job_lock);
+        files[i].done = 1;
+        pthread_cond_broadcast(&job_cond);
+        pthread_mutex_unlock(&job_lock);
+    }
+    return NULL;
+}
 
-    print_token(SYM_ERROR, "unknown");
-    return SYM_ERROR;
+// 合并输出：按输入顺序等待各文件，改成全局符号 ID 后写出一帧
+static int write_combined(void) {
+    int ret = 0;
+    unsigned long long lookups = 0, probes = 0;
+    for (size_t i = 0; i < nfiles; i++) {
+        file_job *f = &files[i];
+        pthread_mutex_lock(&job_lock);
+        while (!f->done) pthread_cond_wait(&job_cond, &job_lock);
+        pthread_mutex_unlock(&job_lock);
+
+        if (!f->error && ret == 0) {
+            uint32_t *map = merge_symbols(&f->syms);
+            if (!map) {
+                fprintf(stderr, "Out of memory\n");
+                ret = -1;
+            }
+            for (uint32_t k = 0; map && k < f->bw.ntokens; k++)
+                f->bw.recs[k].id = map[f->bw.recs[k].id];
+            free(map);
+            if (ret == 0 &&
+                (tokbin_write_file_mark(stdout, f->path) != 0 || tokbin_write(&f->bw, stdout) != 0)) {
+                fprintf(stderr, "Write error\n");
+                ret = -1;
+            }
+        }
+        lookups += f->syms.lookups;
+        probes += f->syms.probes;
+        tokbin_writer_free(&f->bw);
+        intern_free(&f->syms);
+    }
+    symtab.lookups = lookups;
+    symtab.probes = probes;
+    return ret;
+}
+
+// 分析全部文件，有文件失败返回 -1
+static int lex_batch(void) {
+    if (nfiles == 0) return 0;
+    nworkers = (size_t)nthreads < nfiles ? nthreads : (int)nfiles;
+    ranges = calloc(nworkers, sizeof(work_range));
+    pthread_t *tids = malloc(nworkers * sizeof(pthread_t));
+    if (!ranges || !tids) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+    for (int t = 0; t < nworkers; t++) {
+        pthread_mutex_init(&ranges[t].lock, NULL);
+        ranges[t].lo = nfiles * t / nworkers;
+        ranges[t].hi = nfiles * (t + 1) / nworkers;
+    }
+
+    int started = 0;
+    while (started < nworkers &&
+           pthread_create(&tids[started], NULL, batch_worker, (void *)(intptr_t)started) == 0)
+        started++;
+    if (started == 0) batch_worker(NULL);   // 建不了线程就在当前线程里做，别的区间靠偷
+
+    int ret = out_dir ? 0 : write_combined();
+    for (int t = 0; t < started; t++) pthread_join(tids[t], NULL);
+
+    for (int t = 0; t < nworkers; t++) pthread_mutex_destroy(&ranges[t].lock);
+    for (size_t i = 0; i < nfiles; i++) free(files[i].path);
+    free(tids);
+    free(ranges);
+    free(files);
+    return ret == 0 && batch_failed == 0 ? 0 : -1;
 }
 
 
 int main(int argc, char *argv[]) {
-    fin = fopen(argv[1], "r");
-    if (!fin) {
-        printf("Cannot open file: %s\n", argv[1]);
+    const char *path = "-";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-b") == 0)
+            out_binary = 1;
+        else if (strcmp(argv[i], "-z") == 0)
+            out_binary = out_varint = 1;
+        else if (strcmp(argv[i], "-s") == 0)
+            show_stats = 1;
+        else if (strcmp(argv[i], "-t") == 0)
+            truncate_lex = 1;
+        else if (strcmp(argv[i], "-u") == 0)
+            check_utf8 = 1;
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            nthreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0)
+            batch_mode = 1;
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out_dir = argv[++i];
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            stats_path = argv[++i];
+        else
+            path = argv[i];
+    }
+    if (nthreads <= 0) nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads <= 0) nthreads = 1;
+#ifndef PL0_LEX_STATS
+    if (stats_path) {
+        fprintf(stderr, "-p needs a build with -DPL0_LEX_STATS\n");
         return 1;
     }
+#endif
 
-    getch();
+    if ((out_binary || show_stats) && intern_init(&symtab) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
 
-    while (1) {
-        int sym = getsym();
-        if (sym == SYM_NULL) break;
+    if (batch_mode) {
+        if (!out_dir && !out_binary) {
+            fprintf(stderr, "-m without -o writes one combined stream, which needs -b\n");
+            return 1;
+        }
+        if (!out_dir && out_varint) {
+            fprintf(stderr, "-m -z needs -o: the combined stream is tokbin only\n");
+            return 1;
+        }
+        if (out_dir && mkdir(out_dir, 0777) != 0 && errno != EEXIST) {
+            fprintf(stderr, "Cannot create directory: %s\n", out_dir);
+            return 1;
+        }
+        // 输入在选项之后统一收集，-b 等选项的位置不影响
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "-p") == 0) i++;
+            else if (argv[i][0] != '-' || argv[i][1] == '\0') {
+                if (add_input(argv[i]) != 0) {
+                    fprintf(stderr, "Out of memory\n");
+                    return 1;
+                }
+            }
+        }
+        int ret = lex_batch();
+        if (show_stats) {
+            fprintf(stderr, "files: %zu  failed: %zu  tokens: %llu\n", nfiles, batch_failed, batch_tokens);
+            if (!out_dir) {
+                intern_stats st;
+                intern_get_stats(&symtab, &st);
+                fprintf(stderr, "symbols: %u  slots: %u  load: %.3f  arena: %zu bytes  "
+                                "lookups: %llu  avg probes: %.3f\n",
+                        st.nsyms, st.nslots, st.load, st.arena_bytes, st.lookups, st.avg_probes);
+            }
+        }
+        intern_free(&symtab);
+        if (dump_stats() != 0) ret = 1;
+        return ret == 0 ? 0 : 1;
     }
 
-    fclose(fin);
-    return 0;
+    int ret = 1;
+    if (nthreads > 1) {
+        ret = lex_parallel(path);
+        if (ret < 0) return 1;
+    }
+    if (ret == 1) {
+        pl0_lexer *lx = pl0_lexer_open(path);
+        if (!lx) {
+            printf("Cannot open file: %s\n", path);
+            return 1;
+        }
+
+        pl0_lexer_set_truncate(lx, truncate_lex);
+        pl0_lexer_set_utf8(lx, check_utf8);     // 出错时下面的 lex_all 报告
+        // 只有用得到符号 ID 时才驻留，文本输出不必多查一次哈希表
+        if (out_binary || show_stats) pl0_lexer_set_intern(lx, &symtab);
+        tokbin_writer_init(&tbw);
+        if (tw_init(&tw_out, STDOUT_FILENO) != 0 || (out_varint && tokvar_writer_init(&tvw, stdout) != 0)) {
+            fprintf(stderr, "Out of memory\n");
+            return 1;
+        }
+
+        int lex_err = lex_all(lx, &tw_out, out_varint ? NULL : &tbw);
+        collect_stats(lx);
+        if (lex_err != 0) {
+            report_lex_error(path, lx);
+            pl0_lexer_close(lx);
+            tw_close(&tw_out);      // 流式输入此前已交出的 token 照常写出
+            return 1;
+        }
+        pl0_lexer_close(lx);
+
+        if (tw_close(&tw_out) != 0 || (out_varint && tokvar_writer_close(&tvw) != 0)) {
+            fprintf(stderr, "Write error\n");
+            return 1;
+        }
+        if (out_binary && !out_varint) {
+            int err = tokbin_write(&tbw, stdout);
+            tokbin_writer_free(&tbw);
+            if (err != 0) {
+                fprintf(stderr, "Write error\n");
+                return 1;
+            }
+        }
+    }
+
+    if (show_stats) {
+        intern_stats st;
+        intern_get_stats(&symtab, &st);
+        fprintf(stderr, "symbols: %u  slots: %u  load: %.3f  arena: %zu bytes  "
+                        "lookups: %llu  avg probes: %.3f\n",
+                st.nsyms, st.nslots, st.load, st.arena_bytes, st.lookups, st.avg_probes);
+    }
+    intern_free(&symtab);
+    return dump_stats() == 0 ? 0 : 1;
 }
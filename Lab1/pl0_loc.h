@@ -0,0 +1,15 @@
+#ifndef PL0_LOC_H
+#define PL0_LOC_H
+
+// 源码位置：行号和列号压缩在一个 64 位整数中，行号在高 32 位，
+// 两个位置可以直接比较先后。行号、列号都从 1 开始，列号按字节计（制表符算 1 列）
+
+#include <stdint.h>
+
+typedef uint64_t pl0_loc;
+
+#define PL0_LOC(line, col)  (((pl0_loc)(line) << 32) | (uint32_t)(col))
+#define PL0_LINE(loc)       ((uint32_t)((loc) >> 32))
+#define PL0_COL(loc)        ((uint32_t)(loc))
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef PL0_SYM_H
+#define PL0_SYM_H
+
+// token types
+enum {
+    SYM_NULL = 0,            // 空
+    SYM_IDENTIFIER = 1,      // 标识符
+    SYM_NUMBER = 2,          // 整数
+
+    SYM_PLUS = 3,            // +
+    SYM_MINUS = 4,           // -
+    SYM_TIMES = 5,           // *
+    SYM_SLASH = 6,           // /
+    SYM_EQU = 7,             // =
+    SYM_GTR = 8,             // >
+    SYM_LES = 9,             // <
+    SYM_NEQ = 10,            // <>
+    SYM_LEQ = 11,            // <=
+    SYM_GEQ = 12,            // >=
+
+    SYM_LPAREN = 13,         // (
+    SYM_RPAREN = 14,         // )
+    SYM_LBRACE = 15,         // {
+    SYM_RBRACE = 16,         // }
+    SYM_SEMICOLON = 17,      // ;
+    SYM_COMMA = 18,          // , 
+    SYM_ASSIGN = 20,         // :=
+
+    SYM_VAR = 21,            // var
+    SYM_IF = 22,             // if
+    SYM_THEN = 23,           // then
+    SYM_ELSE = 24,           // else
+    SYM_WHILE = 25,          // while
+    SYM_FOR = 26,            // for
+    SYM_BEGIN = 27,          // begin
+    SYM_WRITELN = 28,        // writeln
+    SYM_PROCEDURE = 29,      // procedure
+    SYM_END = 30,            // end
+
+    SYM_CONST = 31,          // const
+    SYM_CALL = 32,           // call
+    SYM_DO = 33,             // do
+    SYM_WRITE = 34,          // write
+    SYM_PERIOD = 35,         // .
+    SYM_STRING = 36,         // "string"
+
+    SYM_LBRACKET = 37,       // [
+    SYM_RBRACKET = 38,       // ]
+
+    SYM_ERROR = 100          // 出错
+};
+
+#endif
@@ -0,0 +1,294 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pl0inc.h"
+
+#define CHUNK_SIZE  (64 * 1024)     // arena 每块大小
+#define BATCH_SIZE  64              // 每次从词法分析器取出的 token 数
+
+#define ALIGN8(n) (((n) + 7) & ~(size_t)7)
+
+typedef struct doc_chunk doc_chunk;
+
+struct doc_chunk {
+    doc_chunk *next;
+    size_t used, cap;
+    char data[];
+};
+
+typedef struct {
+    const char *text;           // 行文本，不含换行
+    uint32_t len;
+    uint32_t ntok;
+    pl0_token *toks;            // 本行的 token，loc 中只有列
+} doc_line;
+
+struct pl0_doc {
+    doc_line *lines;
+    uint32_t nlines, line_cap;
+    size_t ntokens;
+
+    doc_chunk *chunks;          // arena 块链表，表头为当前块
+    size_t arena_bytes;         // arena 中已分配的字节数
+    size_t live_bytes;          // 其中仍被各行引用的字节数
+
+    intern_table syms;          // 标识符 / 字符串驻留表
+
+    // 重新分析一段行时的临时空间
+    pl0_token *scratch;
+    size_t scratch_cap;
+    doc_line *new_lines;
+    uint32_t new_cap;
+};
+
+//=========================
+//     arena
+//=========================
+// 从 *head 链上分配 n 字节（按 8 字节对齐，token 数组直接放在里面）
+static void *chunk_alloc(doc_chunk **head, size_t n) {
+    n = ALIGN8(n);
+    doc_chunk *c = *head;
+    if (!c || c->cap - c->used < n) {
+        size_t cap = n > CHUNK_SIZE ? n : CHUNK_SIZE;
+        c = malloc(sizeof(doc_chunk) + cap);
+        if (!c) return NULL;
+        c->next = *head;
+        c->used = 0;
+        c->cap = cap;
+        *head = c;
+    }
+    void *p = c->data + c->used;
+    c->used += n;
+    return p;
+}
+
+static void chunk_free(doc_chunk *c) {
+    while (c) {
+        doc_chunk *next = c->next;
+        free(c);
+        c = next;
+    }
+}
+
+static void *arena_alloc(pl0_doc *d, size_t n) {
+    void *p = chunk_alloc(&d->chunks, n);
+    if (p) d->arena_bytes += ALIGN8(n);
+    return p;
+}
+
+// 一行在 arena 中占用的字节数
+static size_t line_bytes(const doc_line *l) {
+    return (l->len + 1) + (size_t)l->ntok * sizeof(pl0_token);
+}
+
+// 被替换的行累积到比有效数据还多时，把仍在用的行拷到一块新的 arena，旧块整体释放。
+// 未驻留的词素指向本行文本，随之改指新位置；驻留的不动，符号 ID 不变。内存不足时保持原样
+static void compact(pl0_doc *d) {
+    if (d->arena_bytes <= 2 * d->live_bytes + CHUNK_SIZE) return;
+
+    size_t need = 0;
+    for (uint32_t i = 0; i < d->nlines; i++)
+        need += ALIGN8((size_t)d->lines[i].ntok * sizeof(pl0_token)) + ALIGN8(d->lines[i].len + 1);
+    doc_chunk *c = malloc(sizeof(doc_chunk) + need);
+    if (!c) return;
+    c->next = NULL;
+    c->used = c->cap = need;
+
+    char *p = c->data;
+    for (uint32_t i = 0; i < d->nlines; i++) {
+        doc_line *l = &d->lines[i];
+        size_t tn = (size_t)l->ntok * sizeof(pl0_token);
+        if (tn) memcpy(p, l->toks, tn);
+        pl0_token *toks = (pl0_token *)p;
+        l->toks = l->ntok ? toks : NULL;
+        p += ALIGN8(tn);
+        memcpy(p, l->text, l->len);
+        for (uint32_t k = 0; k < l->ntok; k++) {
+            uintptr_t off = (uintptr_t)toks[k].text - (uintptr_t)l->text;
+            if (!toks[k].id && off < l->len) toks[k].text = p + off;
+        }
+        l->text = p;
+        p += ALIGN8(l->len + 1);
+    }
+    chunk_free(d->chunks);
+    d->chunks = c;
+    d->arena_bytes = need;
+}
+
+//=========================
+//     重新分析
+//=========================
+// 分析 [buf, buf + n) 中的若干整行，token 存入 d->scratch，返回个数；出错返回 -1。
+// 标识符 / 字符串由分析器驻留；其余词素直接指向 buf（即各行在 arena 中的文本）
+// 或静态字符串，不另外保存，驻留表只随不同的名字增长
+static long lex_region(pl0_doc *d, const char *buf, size_t n) {
+    pl0_lexer *lx = pl0_lexer_open_mem(buf, n);
+    if (!lx) return -1;
+    pl0_lexer_set_intern(lx, &d->syms);
+
+    size_t ntok = 0, k;
+    int err = 0;
+    do {
+        if (d->scratch_cap - ntok < BATCH_SIZE) {
+            size_t cap = d->scratch_cap ? d->scratch_cap * 2 : 1024;
+            pl0_token *p = realloc(d->scratch, cap * sizeof(pl0_token));
+            if (!p) {
+                err = 1;
+                break;
+            }
+            d->scratch = p;
+            d->scratch_cap = cap;
+        }
+        k = pl0_lex_batch(lx, d->scratch + ntok, BATCH_SIZE);
+        ntok += k;
+    } while (k > 0);
+
+    if (pl0_lexer_error(lx)) err = 1;
+    pl0_lexer_close(lx);
+    return err ? -1 : (long)ntok;
+}
+
+// 用 [buf, buf + n) 中的若干整行替换从第 first 行（从 0 起）开始的 nold 行。
+// buf 由 arena 分配，buf[n] 为 '\0'
+static int replace_lines(pl0_doc *d, uint32_t first, uint32_t nold, const char *buf, size_t n) {
+    long ntok = lex_region(d, buf, n);
+    if (ntok < 0) return -1;
+
+    // 切分新行
+    uint32_t nnew = 0;
+    const char *p = buf, *end = buf + n;
+    for (;;) {
+        if (nnew == d->new_cap) {
+            uint32_t cap = d->new_cap ? d->new_cap * 2 : 64;
+            doc_line *q = realloc(d->new_lines, (size_t)cap * sizeof(doc_line));
+            if (!q) return -1;
+            d->new_lines = q;
+            d->new_cap = cap;
+        }
+        const char *nl = memchr(p, '\n', end - p);
+        doc_line *l = &d->new_lines[nnew++];
+        l->text = p;
+        l->len = (nl ? nl : end) - p;
+        l->ntok = 0;
+        l->toks = NULL;
+        if (!nl) break;
+        p = nl + 1;
+    }
+
+    uint32_t nlines = d->nlines - nold + nnew;
+    if (nlines > d->line_cap) {
+        uint32_t cap = d->line_cap ? d->line_cap : 1024;
+        while (cap < nlines) cap *= 2;
+        doc_line *q = realloc(d->lines, (size_t)cap * sizeof(doc_line));
+        if (!q) return -1;
+        d->lines = q;
+        d->line_cap = cap;
+    }
+
+    // 按行号把 token 分到各行，只保留列号
+    pl0_token *toks = NULL;
+    if (ntok > 0 && !(toks = arena_alloc(d, (size_t)ntok * sizeof(pl0_token)))) return -1;
+    for (long i = 0; i < ntok; i++) {
+        doc_line *l = &d->new_lines[PL0_LINE(d->scratch[i].loc) - 1];
+        toks[i] = d->scratch[i];
+        toks[i].loc = PL0_LOC(0, PL0_COL(toks[i].loc));
+        if (l->ntok++ == 0) l->toks = &toks[i];
+    }
+
+    // 拼回行表，后面的行整体挪动，token 不动
+    for (uint32_t i = first; i < first + nold; i++) {
+        d->ntokens -= d->lines[i].ntok;
+        d->live_bytes -= line_bytes(&d->lines[i]);
+    }
+    memmove(d->lines + first + nnew, d->lines + first + nold,
+            (size_t)(d->nlines - first - nold) * sizeof(doc_line));
+    memcpy(d->lines + first, d->new_lines, (size_t)nnew * sizeof(doc_line));
+    for (uint32_t i = first; i < first + nnew; i++)
+        d->live_bytes += line_bytes(&d->lines[i]);
+    d->ntokens += ntok;
+    d->nlines = nlines;
+
+    compact(d);
+    return 0;
+}
+
+//=========================
+//     对外接口
+//=========================
+pl0_doc *pl0_doc_open(const char *data, size_t len) {
+    pl0_doc *d = calloc(1, sizeof(*d));
+    if (!d) return NULL;
+    if (intern_init(&d->syms) != 0) {
+        free(d);
+        return NULL;
+    }
+    char *buf = arena_alloc(d, len + 1);
+    if (buf) {
+        memcpy(buf, data, len);
+        buf[len] = '\0';
+    }
+    if (!buf || replace_lines(d, 0, 0, buf, len) != 0) {
+        pl0_doc_close(d);
+        return NULL;
+    }
+    return d;
+}
+
+void pl0_doc_close(pl0_doc *d) {
+    if (!d) return;
+    chunk_free(d->chunks);
+    intern_free(&d->syms);
+    free(d->lines);
+    free(d->scratch);
+    free(d->new_lines);
+    free(d);
+}
+
+int pl0_doc_edit(pl0_doc *d, pl0_loc start, pl0_loc end, const char *text, size_t len) {
+    uint32_t l0 = PL0_LINE(start), c0 = PL0_COL(start);
+    uint32_t l1 = PL0_LINE(end), c1 = PL0_COL(end);
+    if (start > end || l0 < 1 || l1 > d->nlines || c0 < 1 || c1 < 1) return -1;
+    const doc_line *a = &d->lines[l0 - 1], *b = &d->lines[l1 - 1];
+    if (c0 - 1 > a->len || c1 - 1 > b->len) return -1;
+
+    // 新内容 = 首行在 start 之前的部分 + text + 末行在 end 之后的部分
+    size_t pre = c0 - 1, post = b->len - (c1 - 1);
+    size_t n = pre + len + post;
+    char *buf = arena_alloc(d, n + 1);
+    if (!buf) return -1;
+    memcpy(buf, a->text, pre);
+    memcpy(buf + pre, text, len);
+    memcpy(buf + pre + len, b->text + (c1 - 1), post);
+    buf[n] = '\0';
+    return replace_lines(d, l0 - 1, l1 - l0 + 1, buf, n);
+}
+
+uint32_t pl0_doc_lines(const pl0_doc *d) {
+    return d->nlines;
+}
+
+size_t pl0_doc_ntokens(const pl0_doc *d) {
+    return d->ntokens;
+}
+
+uint32_t pl0_doc_line(const pl0_doc *d, uint32_t line, const pl0_token **toks) {
+    if (line < 1 || line > d->nlines) {
+        *toks = NULL;
+        return 0;
+    }
+    *toks = d->lines[line - 1].toks;
+    return d->lines[line - 1].ntok;
+}
+
+uint32_t pl0_doc_line_text(const pl0_doc *d, uint32_t line, const char **text) {
+    if (line < 1 || line > d->nlines) {
+        *text = NULL;
+        return 0;
+    }
+    *text = d->lines[line - 1].text;
+    return d->lines[line - 1].len;
+}
+
+const intern_table *pl0_doc_symbols(const pl0_doc *d) {
+    return &d->syms;
+}
@@ -0,0 +1,53 @@
+#ifndef PL0INC_H
+#define PL0INC_H
+
+// 增量词法分析：源程序按行保存，每行缓存自己的 token
+//
+//     pl0_doc *d = pl0_doc_open(src, len);
+//     pl0_doc_edit(d, PL0_LOC(3, 5), PL0_LOC(3, 8), "abc", 3);    // 第 3 行第 5~7 列改为 abc
+//     const pl0_token *toks;
+//     uint32_t n = pl0_doc_line(d, 3, &toks);
+//     pl0_doc_close(d);
+//
+// 注释和字符串都不能跨行，token 不会跨过换行，
+// 所以一次编辑只需重新分析它涉及的那几行，再把结果拼回各行的 token 表，
+// 其余行的 token 原样保留。
+//
+// 文本和 token 放在 arena 中，被替换的行不立即释放，
+// 垃圾超过有效数据时整体压缩一次，均摊下来每次编辑仍只与改动的行有关。
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pl0lex.h"
+
+typedef struct pl0_doc pl0_doc;
+
+// 复制 [data, data + len) 并完整分析一遍。失败返回 NULL
+pl0_doc *pl0_doc_open(const char *data, size_t len);
+void pl0_doc_close(pl0_doc *d);
+
+// 把 [start, end) 替换为 [text, text + len)，text 中可以有换行。
+// 位置用 pl0_loc 表示，行、列都从 1 开始，列按字节计，
+// 行尾位置为 行长 + 1；删除第 n 行末的换行即 [PL0_LOC(n, 行长 + 1), PL0_LOC(n + 1, 1))。
+// 位置非法或内存不足返回 -1，文档保持不变
+int pl0_doc_edit(pl0_doc *d, pl0_loc start, pl0_loc end, const char *text, size_t len);
+
+// 行数：换行数 + 1
+uint32_t pl0_doc_lines(const pl0_doc *d);
+// 全部 token 数
+size_t pl0_doc_ntokens(const pl0_doc *d);
+
+// 第 line 行（从 1 开始）的 token，返回个数，*toks 在下一次编辑前有效。
+// 编辑会改变后面各行的行号，缓存的 token 只记列号：loc 中行号部分为 0，
+// 行号即 line。标识符 / 字符串驻留在文档自己的驻留表中，文档关闭前一直有效，
+// 符号 ID 在整个文档生存期内稳定；其余词素指向行文本或静态字符串，
+// 不以 '\0' 结尾，与 *toks 一样只在下一次编辑前有效
+uint32_t pl0_doc_line(const pl0_doc *d, uint32_t line, const pl0_token **toks);
+// 第 line 行的文本（不含换行、不以 '\0' 结尾），返回长度
+uint32_t pl0_doc_line_text(const pl0_doc *d, uint32_t line, const char **text);
+
+// 文档的驻留表（只读）
+const intern_table *pl0_doc_symbols(const pl0_doc *d);
+
+#endif
@@ -0,0 +1,1011 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pl0lex.h"
+#include "keyword_trie.h"
+#include "lex_simd.h"
+#if defined(PL0_LEX_STATS) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define PROF_TSC() __rdtsc()
+#else
+#define PROF_TSC() 0ULL
+#endif
+
+#define BLOCK_SIZE  (64 * 1024)   // 流式输入每块大小
+
+// state types
+typedef enum {
+    STATE_START,
+    STATE_INID,        // 标识符状态
+    STATE_INNUM,       // 数字状态
+    STATE_INBADNUM,    // 数字后接字母（出错）
+    STATE_INASSIGN,    // 遇到 :
+    STATE_INLES,       // 遇到 <
+    STATE_INGTR,       // 遇到 >
+    STATE_INCOMMENT,   // 注释状态
+    STATE_INSTRING,    // 字符串状态（你原来的 STATE_INCHAR 改名更准确）
+    STATE_SINGLE,      // 单字符符号
+    STATE_ILLEGAL,     // 非法字符
+    STATE_EOF,         // 输入结束
+    STATE_NUL,         // 读到 '\0'：可能是块末哨兵，跳出快速循环另行判断
+    STATE_DONE,        // 完成状态
+    STATE_ERROR,       // 出错状态
+    STATE_COUNT
+} DFA_State;
+
+// 字符类别：与 locale 无关，字节 >= 0x80 一律视为非法字符
+typedef enum {
+    CC_OTHER,          // 非法字符
+    CC_SPACE,          // 空白（不含换行）
+    CC_NEWLINE,        // \n
+    CC_ALPHA,          // 字母
+    CC_DIGIT,          // 数字
+    CC_COLON,          // :
+    CC_LES,            // <
+    CC_GTR,            // >
+    CC_LBRACE,         // {
+    CC_RBRACE,         // }
+    CC_QUOTE,          // "
+    CC_SINGLE,         // 单字符符号 + - * / ( ) ; [ ] = , .
+    CC_NUL,            // '\0'
+    CC_EOF,            // EOF
+    CC_COUNT
+} CharClass;
+
+// 字符类别表，下标为 ch + 1，使 EOF (-1) 落在 0 号位置
+static const unsigned char char_class[257] = {
+    [0]                 = CC_EOF,
+    [1 + '\0']          = CC_NUL,
+    [1 + '\t']          = CC_SPACE,
+    [1 + '\n']          = CC_NEWLINE,
+    [1 + '\v']          = CC_SPACE,
+    [1 + '\f']          = CC_SPACE,
+    [1 + '\r']          = CC_SPACE,
+    [1 + ' ']           = CC_SPACE,
+    [1 + 'A' ... 1 + 'Z'] = CC_ALPHA,
+    [1 + 'a' ... 1 + 'z'] = CC_ALPHA,
+    [1 + '0' ... 1 + '9'] = CC_DIGIT,
+    [1 + ':']           = CC_COLON,
+    [1 + '<']           = CC_LES,
+    [1 + '>']           = CC_GTR,
+    [1 + '{']           = CC_LBRACE,
+    [1 + '}']           = CC_RBRACE,
+    [1 + '"']           = CC_QUOTE,
+    [1 + '+']           = CC_SINGLE,
+    [1 + '-']           = CC_SINGLE,
+    [1 + '*']           = CC_SINGLE,
+    [1 + '/']           = CC_SINGLE,
+    [1 + '(']           = CC_SINGLE,
+    [1 + ')']           = CC_SINGLE,
+    [1 + ';']           = CC_SINGLE,
+    [1 + '[']           = CC_SINGLE,
+    [1 + ']']           = CC_SINGLE,
+    [1 + '=']           = CC_SINGLE,
+    [1 + ',']           = CC_SINGLE,
+    [1 + '.']           = CC_SINGLE,
+};
+
+#define CLASS_OF(c) char_class[(c) + 1]
+
+// 状态转移表：dfa_trans[当前状态][字符类别] = 下一状态。
+// 只列出有循环的状态；<、>、: 只看一个字符，在 getsym() 中直接判断
+static const unsigned char dfa_trans[STATE_COUNT][CC_COUNT] = {
+    [STATE_START] = {
+        [CC_OTHER]   = STATE_ILLEGAL,
+        [CC_SPACE]   = STATE_START,
+        [CC_NEWLINE] = STATE_START,
+        [CC_ALPHA]   = STATE_INID,
+        [CC_DIGIT]   = STATE_INNUM,
+        [CC_COLON]   = STATE_INASSIGN,
+        [CC_LES]     = STATE_INLES,
+        [CC_GTR]     = STATE_INGTR,
+        [CC_LBRACE]  = STATE_INCOMMENT,
+        [CC_RBRACE]  = STATE_ILLEGAL,
+        [CC_QUOTE]   = STATE_INSTRING,
+        [CC_SINGLE]  = STATE_SINGLE,
+        [CC_NUL]     = STATE_ILLEGAL,   // 初始状态下的 '\0' 只可能是真实字节
+        [CC_EOF]     = STATE_EOF,
+    },
+    [STATE_INID] = {
+        [CC_OTHER]   = STATE_DONE,
+        [CC_SPACE]   = STATE_DONE,
+        [CC_NEWLINE] = STATE_DONE,
+        [CC_ALPHA]   = STATE_INID,
+        [CC_DIGIT]   = STATE_INID,
+        [CC_COLON]   = STATE_DONE,
+        [CC_LES]     = STATE_DONE,
+        [CC_GTR]     = STATE_DONE,
+        [CC_LBRACE]  = STATE_DONE,
+        [CC_RBRACE]  = STATE_DONE,
+        [CC_QUOTE]   = STATE_DONE,
+        [CC_SINGLE]  = STATE_DONE,
+        [CC_NUL]     = STATE_NUL,
+        [CC_EOF]     = STATE_DONE,
+    },
+    [STATE_INNUM] = {
+        [CC_OTHER]   = STATE_DONE,
+        [CC_SPACE]   = STATE_DONE,
+        [CC_NEWLINE] = STATE_DONE,
+        [CC_ALPHA]   = STATE_INBADNUM,
+        [CC_DIGIT]   = STATE_INNUM,
+        [CC_COLON]   = STATE_DONE,
+        [CC_LES]     = STATE_DONE,
+        [CC_GTR]     = STATE_DONE,
+        [CC_LBRACE]  = STATE_DONE,
+        [CC_RBRACE]  = STATE_DONE,
+        [CC_QUOTE]   = STATE_DONE,
+        [CC_SINGLE]  = STATE_DONE,
+        [CC_NUL]     = STATE_NUL,
+        [CC_EOF]     = STATE_DONE,
+    },
+    [STATE_INBADNUM] = {
+        [CC_OTHER]   = STATE_DONE,
+        [CC_SPACE]   = STATE_DONE,
+        [CC_NEWLINE] = STATE_DONE,
+        [CC_ALPHA]   = STATE_INBADNUM,
+        [CC_DIGIT]   = STATE_INBADNUM,
+        [CC_COLON]   = STATE_DONE,
+        [CC_LES]     = STATE_DONE,
+        [CC_GTR]     = STATE_DONE,
+        [CC_LBRACE]  = STATE_DONE,
+        [CC_RBRACE]  = STATE_DONE,
+        [CC_QUOTE]   = STATE_DONE,
+        [CC_SINGLE]  = STATE_DONE,
+        [CC_NUL]     = STATE_NUL,
+        [CC_EOF]     = STATE_DONE,
+    },
+    [STATE_INCOMMENT] = {
+        [CC_OTHER]   = STATE_INCOMMENT,
+        [CC_SPACE]   = STATE_INCOMMENT,
+        [CC_NEWLINE] = STATE_ERROR,
+        [CC_ALPHA]   = STATE_INCOMMENT,
+        [CC_DIGIT]   = STATE_INCOMMENT,
+        [CC_COLON]   = STATE_INCOMMENT,
+        [CC_LES]     = STATE_INCOMMENT,
+        [CC_GTR]     = STATE_INCOMMENT,
+        [CC_LBRACE]  = STATE_INCOMMENT,
+        [CC_RBRACE]  = STATE_START,
+        [CC_QUOTE]   = STATE_INCOMMENT,
+        [CC_SINGLE]  = STATE_INCOMMENT,
+        [CC_NUL]     = STATE_NUL,
+        [CC_EOF]     = STATE_ERROR,
+    },
+    [STATE_INSTRING] = {
+        [CC_OTHER]   = STATE_INSTRING,
+        [CC_SPACE]   = STATE_INSTRING,
+        [CC_NEWLINE] = STATE_ERROR,
+        [CC_ALPHA]   = STATE_INSTRING,
+        [CC_DIGIT]   = STATE_INSTRING,
+        [CC_COLON]   = STATE_INSTRING,
+        [CC_LES]     = STATE_INSTRING,
+        [CC_GTR]     = STATE_INSTRING,
+        [CC_LBRACE]  = STATE_INSTRING,
+        [CC_RBRACE]  = STATE_INSTRING,
+        [CC_QUOTE]   = STATE_DONE,
+        [CC_SINGLE]  = STATE_INSTRING,
+        [CC_NUL]     = STATE_NUL,
+        [CC_EOF]     = STATE_ERROR,
+    },
+};
+
+// 单字符符号表
+static const unsigned char single_sym[128] = {
+    ['+'] = SYM_PLUS,
+    ['-'] = SYM_MINUS,
+    ['*'] = SYM_TIMES,
+    ['/'] = SYM_SLASH,
+    ['('] = SYM_LPAREN,
+    [')'] = SYM_RPAREN,
+    [';'] = SYM_SEMICOLON,
+    ['['] = SYM_LBRACKET,
+    [']'] = SYM_RBRACKET,
+    ['='] = SYM_EQU,
+    [','] = SYM_COMMA,
+    ['.'] = SYM_PERIOD,
+};
+
+#define TEXT_SIZE   (16 * 1024)   // 流式输入词素存放块的初始大小
+
+typedef struct text_block text_block;
+
+struct text_block {
+    text_block *next;
+    char data[];
+};
+
+struct pl0_lexer {
+    // 当前数据块位于 [cur, lim) 中，*lim 恒为哨兵 '\0'。
+    // 普通文件直接 mmap（映射区末尾多留一页全零，天然带哨兵）；
+    // 管道 / 终端等无法映射的输入用两块定长缓冲交替读入，内存占用与输入大小无关
+    const unsigned char *cur;   // 下一个待读字符
+    const unsigned char *lim;   // 当前块末尾（哨兵位置）
+    int ch;                     // 当前字符
+    uint32_t line;              // 当前字符所在行
+
+    // 列号：按输入开头算起的绝对偏移计算，跨块也不用重新计数
+    const unsigned char *base;  // 当前块开头
+    uint64_t base_pos;          // base 的绝对偏移
+    uint64_t line_pos;          // 当前行行首的绝对偏移
+
+    unsigned char *map_base;    // mmap 起始地址，NULL 表示非映射输入
+    size_t map_len;             // 映射区总长度（含哨兵页）
+    int fd;                     // 流式输入的描述符，-1 表示已读完或非流式
+    int close_fd;               // 读完后是否需要 close(fd)
+    unsigned char *blocks;      // 双缓冲，每块 BLOCK_SIZE + 1 字节，末尾留一个哨兵位
+    int half;
+
+    // 词素长度上限，默认不限；截断兼容模式下为 MAX_*_LEN - 1
+    size_t max_id, max_num, max_str;
+
+    // 流式输入的块会被循环覆盖，词素要拷到这里；
+    // 映射 / 内存输入的词素直接指向源程序，不用这块
+    text_block *text;           // 当前存放块
+    size_t text_len, text_cap;
+    size_t tok_start;           // 正在拼的词素在当前块中的起点
+    text_block *retired;        // 本批换下来的存放块，下一批开始时释放
+
+    intern_table *intern;       // 非 NULL 时驻留标识符和字符串
+
+    // UTF-8 模式：流式输入每读入一块先校验。块末不完整的序列存起来，
+    // 用下一块开头的字节补全后再校验
+    int utf8;
+    int utf8_trusted;           // 调用方已校验过输入，不再逐块校验
+    unsigned char u8_carry[4];
+    int u8_ncarry;
+    uint64_t u8_carry_pos;      // u8_carry 在输入中的绝对偏移
+
+    int error;                  // 0 或 PL0_LEX_*
+    pl0_loc error_loc;
+
+#ifdef PL0_LEX_STATS
+    pl0_lex_stats stats;
+    uint64_t ncalls;            // lex_one 的调用次数，用于抽样
+#endif
+};
+
+// 每个字节对应的单字符词素，单字符 token 直接指向这里，不必拷贝
+static char single_text[256][2];
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+
+static void lexer_init(void) {
+    for (int c = 0; c < 256; c++) single_text[c][0] = (char)c;
+    lex_simd_init();
+}
+
+//=========================
+//     输入
+//=========================
+static int check_block(pl0_lexer *lx, uint64_t pos, const unsigned char *p, const unsigned char *end);
+static void utf8_error(pl0_lexer *lx, uint64_t pos, const unsigned char *blk, const unsigned char *bad);
+
+// 换入下一块，返回新块的第一个字符；输入结束时返回 EOF
+static int next_block(pl0_lexer *lx) {
+    lx->cur = lx->lim;  // 停在哨兵上，之后再读仍会回到这里
+    if (lx->fd < 0) return EOF;
+
+    lx->half ^= 1;
+    unsigned char *blk = lx->blocks + lx->half * (BLOCK_SIZE + 1);
+    ssize_t n;
+    do {
+        n = read(lx->fd, blk, BLOCK_SIZE);
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0 || (lx->utf8 && !lx->utf8_trusted && check_block(lx, lx->base_pos + (lx->lim - lx->base), blk, blk + n) != 0)) {
+        if (lx->close_fd) close(lx->fd);
+        lx->fd = -1;
+        if (n <= 0 && lx->u8_ncarry) utf8_error(lx, 0, NULL, NULL);    // 输入在多字节字符中间结束
+        return EOF;
+    }
+
+    blk[n] = '\0';
+    lx->base_pos += lx->lim - lx->base;
+    lx->base = blk;
+    lx->cur = blk;
+    lx->lim = blk + n;
+    return *lx->cur++;
+}
+
+//=========================
+//     流式输入的词素存放
+//=========================
+static void free_text_blocks(text_block *b) {
+    while (b) {
+        text_block *next = b->next;
+        free(b);
+        b = next;
+    }
+}
+
+// 把 [p, p + n) 接到正在拼的词素后面。放不下时换一块更大的，
+// 已拷出的部分搬过去；旧块上还有本批已产出的词素，留到下一批再释放
+static int text_append(pl0_lexer *lx, const void *p, size_t n) {
+    if (!lx->text || lx->text_cap - lx->text_len < n) {
+        size_t part = lx->text_len - lx->tok_start;
+        size_t cap = lx->text_cap ? lx->text_cap * 2 : TEXT_SIZE;
+        while (cap < part + n) cap *= 2;
+        text_block *b = malloc(sizeof(text_block) + cap);
+        if (!b) return -1;
+        if (lx->text) {
+            memcpy(b->data, lx->text->data + lx->tok_start, part);
+            lx->text->next = lx->retired;
+            lx->retired = lx->text;
+        }
+        lx->text = b;
+        lx->text_cap = cap;
+        lx->text_len = part;
+        lx->tok_start = 0;
+    }
+    memcpy(lx->text->data + lx->text_len, p, n);
+    lx->text_len += n;
+    return 0;
+}
+
+static pl0_lexer *lexer_new(void) {
+    pthread_once(&init_once, lexer_init);
+    pl0_lexer *lx = calloc(1, sizeof(*lx));
+    if (!lx) return NULL;
+    lx->max_id = lx->max_num = lx->max_str = SIZE_MAX;
+    lx->fd = -1;
+    lx->line = 1;
+    lx->half = 1;
+    return lx;
+}
+
+// 读入第一个字符
+static pl0_lexer *lexer_start(pl0_lexer *lx) {
+    lx->base = lx->cur;
+    lx->ch = *lx->cur++;
+    if (lx->ch == '\0' && lx->cur > lx->lim) lx->ch = next_block(lx);
+    return lx;
+}
+
+// 把普通文件整个映射进来，失败（管道、终端、空文件等）返回 NULL
+static unsigned char *map_fd(int fd, int prot, size_t *size, size_t *map_len) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) return NULL;
+
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t len = ((size_t)st.st_size + page) / page * page;
+
+    // 先占一段全零的匿名区，再把文件覆盖映射到开头，
+    // 文件末尾之后至少有一个零字节可作哨兵
+    void *base = mmap(NULL, len, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return NULL;
+    void *p = mmap(base, st.st_size, prot, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    if (p == MAP_FAILED) {
+        munmap(base, len);
+        return NULL;
+    }
+    madvise(p, st.st_size, MADV_SEQUENTIAL);
+    *size = st.st_size;
+    *map_len = len;
+    return p;
+}
+
+char *pl0_map_fd(int fd, size_t *size, size_t *map_len) {
+    return (char *)map_fd(fd, PROT_READ | PROT_WRITE, size, map_len);
+}
+
+void pl0_unmap(char *p, size_t map_len) {
+    munmap(p, map_len);
+}
+
+static pl0_lexer *open_fd(int fd, int close_fd) {
+    pl0_lexer *lx = lexer_new();
+    if (!lx) {
+        if (close_fd) close(fd);
+        return NULL;
+    }
+
+    size_t size;
+    lx->map_base = map_fd(fd, PROT_READ, &size, &lx->map_len);
+    if (lx->map_base) {
+        if (close_fd) close(fd);
+        lx->cur = lx->map_base;
+        lx->lim = lx->map_base + size;
+        return lexer_start(lx);
+    }
+
+    // 流式读入：从空块开始，第一次读字符即触发换块
+    lx->blocks = malloc(2 * (BLOCK_SIZE + 1));
+    if (!lx->blocks) {
+        if (close_fd) close(fd);
+        free(lx);
+        return NULL;
+    }
+    lx->fd = fd;
+    lx->close_fd = close_fd;
+    lx->blocks[lx->half * (BLOCK_SIZE + 1)] = '\0';
+    lx->cur = lx->lim = lx->blocks + lx->half * (BLOCK_SIZE + 1);
+    return lexer_start(lx);
+}
+
+pl0_lexer *pl0_lexer_open(const char *path) {
+    if (!path || strcmp(path, "-") == 0) return open_fd(STDIN_FILENO, 0);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    return open_fd(fd, 1);
+}
+
+pl0_lexer *pl0_lexer_open_fd(int fd) {
+    return open_fd(fd, 0);
+}
+
+pl0_lexer *pl0_lexer_open_mem(const char *data, size_t len) {
+    pl0_lexer *lx = lexer_new();
+    if (!lx) return NULL;
+    lx->cur = (const unsigned char *)data;
+    lx->lim = lx->cur + len;
+    return lexer_start(lx);
+}
+
+void pl0_lexer_close(pl0_lexer *lx) {
+    if (!lx) return;
+    if (lx->map_base) munmap(lx->map_base, lx->map_len);
+    if (lx->fd >= 0 && lx->close_fd) close(lx->fd);
+    free(lx->blocks);
+    free_text_blocks(lx->retired);
+    free(lx->text);
+    free(lx);
+}
+
+void pl0_lexer_set_intern(pl0_lexer *lx, intern_table *tab) {
+    lx->intern = tab;
+}
+
+void pl0_lexer_set_truncate(pl0_lexer *lx, int on) {
+    lx->max_id = on ? MAX_ID_LEN - 1 : SIZE_MAX;
+    lx->max_num = on ? MAX_NUM_LEN - 1 : SIZE_MAX;
+    lx->max_str = on ? MAX_STR_LEN - 1 : SIZE_MAX;
+}
+
+uint32_t pl0_lexer_line(const pl0_lexer *lx) {
+    return lx->line;
+}
+
+int pl0_lexer_is_stream(const pl0_lexer *lx) {
+    return lx->blocks != NULL;
+}
+
+#ifdef PL0_LEX_STATS
+void pl0_lexer_add_stats(const pl0_lexer *lx, pl0_lex_stats *sum) {
+    // 全是 uint64_t 计数，逐个相加
+    const uint64_t *src = (const uint64_t *)&lx->stats;
+    uint64_t *dst = (uint64_t *)sum;
+    for (size_t i = 0; i < sizeof(pl0_lex_stats) / sizeof(uint64_t); i++) dst[i] += src[i];
+}
+
+const char *pl0_lex_state_name(int state) {
+    static const char *const names[STATE_COUNT] = {
+        [STATE_START]     = "start",
+        [STATE_INID]      = "id",
+        [STATE_INNUM]     = "num",
+        [STATE_INBADNUM]  = "badnum",
+        [STATE_INASSIGN]  = "assign",
+        [STATE_INLES]     = "les",
+        [STATE_INGTR]     = "gtr",
+        [STATE_INCOMMENT] = "comment",
+        [STATE_INSTRING]  = "string",
+        [STATE_SINGLE]    = "single",
+        [STATE_ILLEGAL]   = "illegal",
+        [STATE_EOF]       = "eof",
+        [STATE_NUL]       = "nul",
+        [STATE_DONE]      = "done",
+        [STATE_ERROR]     = "error",
+    };
+    return state >= 0 && state < STATE_COUNT ? names[state] : NULL;
+}
+
+const char *pl0_lex_error_name(int kind) {
+    static const char *const names[PL0_LEX_ERR_COUNT] = {
+        [PL0_LEX_ERR_ILLEGAL]   = "illegal_char",
+        [PL0_LEX_ERR_UTF8_CHAR] = "utf8_char",
+        [PL0_LEX_ERR_BADNUM]    = "bad_number",
+        [PL0_LEX_ERR_OVERFLOW]  = "number_overflow",
+        [PL0_LEX_ERR_COLON]     = "lone_colon",
+        [PL0_LEX_ERR_COMMENT]   = "unclosed_comment",
+        [PL0_LEX_ERR_STRING]    = "unclosed_string",
+        [PL0_LEX_ERR_OTHER]     = "other",
+    };
+    return kind >= 0 && kind < PL0_LEX_ERR_COUNT ? names[kind] : NULL;
+}
+#endif
+
+int pl0_lexer_error(const pl0_lexer *lx) {
+    return lx->error;
+}
+
+pl0_loc pl0_lexer_error_loc(const pl0_lexer *lx) {
+    return lx->error_loc;
+}
+
+// 统计 [p, end) 中的换行数，有换行时 *line_start 置为最后一个换行之后的位置
+static inline int count_newlines(const unsigned char *p, const unsigned char *end,
+                                 const unsigned char **line_start) {
+    int n = 0;
+    for (const unsigned char *q = p; q < end; q++) n += (*q == '\n');
+    if (n) {
+        const unsigned char *q = end;
+        while (q[-1] != '\n') q--;
+        *line_start = q;
+    }
+    return n;
+}
+
+//=========================
+//     UTF-8 校验
+//=========================
+size_t pl0_utf8_check(const char *p, size_t len) {
+    pthread_once(&init_once, lexer_init);
+    const unsigned char *s = (const unsigned char *)p;
+    return lex_utf8_check(s, s + len) - s;
+}
+
+// 记下不合法序列的位置。blk 为所在块，绝对偏移为 pos；bad 为 NULL 时是存着的跨块序列。
+// 调用时 lx->line / line_pos 对应块的开头：换块总在读完上一块之后，行号已经数到块末
+static void utf8_error(pl0_lexer *lx, uint64_t pos, const unsigned char *blk, const unsigned char *bad) {
+    uint32_t line = lx->line;
+    uint64_t line_pos = lx->line_pos;
+    if (bad) {
+        const unsigned char *line_start;
+        int n = count_newlines(blk, bad, &line_start);
+        if (n) {
+            line += n;
+            line_pos = pos + (line_start - blk);
+        }
+        pos += bad - blk;
+    } else {
+        pos = lx->u8_carry_pos;     // 多字节序列中没有换行，与块开头同一行
+    }
+    lx->error = PL0_LEX_EUTF8;
+    lx->error_loc = PL0_LOC(line, pos - line_pos + 1);
+}
+
+// 校验 [p, end)，其绝对偏移为 pos。流式输入末尾不完整的序列存到 u8_carry，下一块再接着校验。
+// 不合法返回 -1
+static int check_block(pl0_lexer *lx, uint64_t pos, const unsigned char *p, const unsigned char *end) {
+    const unsigned char *blk = p;
+    // 先补全上一块留下的序列；块很小（如管道一次只读到一两个字节）时可能跨好几块
+    while (lx->u8_ncarry && p < end) {
+        lx->u8_carry[lx->u8_ncarry++] = *p++;
+        int n = lex_utf8_seq(lx->u8_carry, lx->u8_carry + lx->u8_ncarry);
+        if (n < 0) {
+            utf8_error(lx, pos, blk, NULL);
+            return -1;
+        }
+        if (n > 0) lx->u8_ncarry = 0;
+    }
+
+    const unsigned char *bad = lex_utf8_check(p, end);
+    if (bad == end) return 0;
+    if (lx->fd >= 0 && lex_utf8_seq(bad, end) == 0) {
+        lx->u8_ncarry = end - bad;
+        memcpy(lx->u8_carry, bad, lx->u8_ncarry);
+        lx->u8_carry_pos = pos + (bad - blk);
+        return 0;
+    }
+    utf8_error(lx, pos, blk, bad);
+    return -1;
+}
+
+int pl0_lexer_set_utf8(pl0_lexer *lx, int on) {
+    lx->utf8 = on;
+    // 映射 / 内存输入是整个源程序，流式输入是已读入的第一块
+    if (on && check_block(lx, lx->base_pos, lx->base, lx->lim) != 0) return -1;
+    return 0;
+}
+
+void pl0_lexer_set_utf8_trusted(pl0_lexer *lx, int on) {
+    lx->utf8 = on;
+    lx->utf8_trusted = on;
+}
+
+//=========================
+//     DFA
+//=========================
+// 下面的宏操作 lex_one() 中的局部变量 cur / lim / ch：
+// 热循环里的状态放在局部变量中，编译器才能把它们留在寄存器里
+
+// 当前读到的 '\0' 是否为块末哨兵（而不是源文件中真实的 NUL 字节）
+#define AT_BLOCK_END() (cur > lim)
+
+#define NEXT_BLOCK() do {           \
+        lx->cur = cur;              \
+        lx->line = line;            \
+        ch = next_block(lx);        \
+        cur = lx->cur;              \
+        lim = lx->lim;              \
+    } while (0)
+
+// 读取下一个字符
+#define GETCH() do {                                \
+        ch = *cur++;                                \
+        if (ch == '\0' && AT_BLOCK_END()) NEXT_BLOCK(); \
+    } while (0)
+
+// 产出一个词素固定的 token：种别码、词素、词素长度
+#define TOKEN(s, t, n) do { sym = (s); text = (t); k = (n); goto out; } while (0)
+
+// 产出词素为源程序 [tstart, end) 的 token
+#define SLICE(s, end) do { sym = (s); tend = (end); goto slice; } while (0)
+
+// 当前字符 ch 的位置；输入结束时 cur 停在末尾，EOF 不占位置
+#define CH_POS() (ch == EOF ? cur : cur - 1)
+
+// 词素读到块末：流式输入先把本块中的部分拷出，换块后从新块开头接着记。
+// 双缓冲保证换块后上一块仍然有效，词素的最后一段可以在读完向前看字符之后再拷
+#define SPILL_NEXT_BLOCK() do {                                             \
+        if (lx->blocks && text_append(lx, tstart, lim - tstart) != 0)       \
+            goto oom;                                                       \
+        NEXT_BLOCK();                                                       \
+        if (lx->blocks) tstart = CH_POS();                                  \
+    } while (0)
+
+#ifdef PL0_LEX_STATS
+_Static_assert(STATE_COUNT == PL0_LEX_NSTATES, "PL0_LEX_NSTATES");
+
+// 当前字符在输入中的绝对偏移：每个状态读过的字节数即进出该状态时的偏移之差
+#define PROF_POS() (lx->base_pos + (CH_POS() - lx->base))
+
+// 进入状态 s：把上一个状态从 prof_pos 起读过的字节（抽样时还有周期数）记到它名下
+#define PROF_ENTER(s) do {                              \
+        if ((s) != prof_state) {                        \
+            prof_leave(lx, prof_state, &prof_pos, PROF_POS(), prof_sample ? &prof_tsc : NULL); \
+            prof_state = (s);                           \
+        }                                               \
+    } while (0)
+
+static void prof_leave(pl0_lexer *lx, DFA_State state, uint64_t *pos, uint64_t now, uint64_t *tsc) {
+    pl0_lex_stats *st = &lx->stats;
+    st->state_visits[state]++;
+    st->state_bytes[state] += now - *pos;
+    if (tsc) {
+        uint64_t t = PROF_TSC();
+        st->state_cycles[state] += t - *tsc;
+        st->state_sampled_visits[state]++;
+        st->state_sampled_bytes[state] += now - *pos;
+        *tsc = t;
+    }
+    *pos = now;
+}
+
+// 出错 token 的类别：由产出它的状态决定
+static int prof_error_kind(DFA_State state, size_t len) {
+    switch (state) {
+        case STATE_ILLEGAL:   return len > 1 ? PL0_LEX_ERR_UTF8_CHAR : PL0_LEX_ERR_ILLEGAL;
+        case STATE_INBADNUM:  return PL0_LEX_ERR_BADNUM;
+        case STATE_INNUM:     return PL0_LEX_ERR_OVERFLOW;
+        case STATE_INASSIGN:  return PL0_LEX_ERR_COLON;
+        case STATE_INCOMMENT: return PL0_LEX_ERR_COMMENT;
+        case STATE_INSTRING:  return PL0_LEX_ERR_STRING;
+        default:              return PL0_LEX_ERR_OTHER;
+    }
+}
+#else
+#define PROF_ENTER(s) ((void)0)
+#endif
+
+// 识别一个 token 存入 tok，输入结束返回 SYM_NULL。
+// 标识符、数字、字符串的词素是源程序中的一段，映射 / 内存输入时直接指向源程序
+static int lex_one(pl0_lexer *lx, pl0_token *tok) {
+    const unsigned char *cur = lx->cur;
+    const unsigned char *lim = lx->lim;
+    int ch = lx->ch;
+    uint32_t line = lx->line;
+    DFA_State state = STATE_START;
+    size_t k = 0;                       // 已读入词素的长度，用于截断兼容模式
+    int64_t value = 0;                  // 数字的值
+    int overflow = 0;                   // 数字超出 int64_t
+    unsigned kw = KW_TRIE_ROOT;         // 标识符在关键字 trie 中走到的状态
+    const unsigned char *tstart = cur;  // 词素（在当前块中的部分）的起点
+    const unsigned char *tend;
+    int sym;
+    const char *text;
+#ifdef PL0_LEX_STATS
+    DFA_State prof_state = STATE_START;     // 正在计数的状态，从 prof_pos 处进入
+    uint64_t prof_pos = PROF_POS();
+    int prof_sample = lx->ncalls++ % PL0_LEX_SAMPLE == 0;
+    uint64_t prof_tsc = prof_sample ? PROF_TSC() : 0;
+    lx->stats.sampled_tokens += prof_sample;
+#endif
+
+    while (state != STATE_DONE && state != STATE_ERROR) {
+        PROF_ENTER(state);
+
+        switch (state) {
+
+            //=========================
+            //     初始状态
+            //=========================
+            case STATE_START:
+                // 查一次表即得到下一状态；空白停留在初始状态，
+                // 连续空白（如缩进）交给向量内核一次跳过
+                while ((state = dfa_trans[STATE_START][CLASS_OF(ch)]) == STATE_START) {
+                    if (ch == '\n') {
+                        line++;
+                        lx->line_pos = lx->base_pos + (cur - lx->base);
+                    }
+                    if (dfa_trans[STATE_START][CLASS_OF(*cur)] == STATE_START) {
+                        const unsigned char *from = cur, *line_start;
+                        cur = lex_skip_space(cur, lim);
+                        int n = count_newlines(from, cur, &line_start);
+                        if (n) {
+                            line += n;
+                            lx->line_pos = lx->base_pos + (line_start - lx->base);
+                        }
+                    }
+                    GETCH();
+                }
+                // 换行只出现在空白中，token 不会跨行；ch 就在 cur - 1 处
+                tok->loc = PL0_LOC(line, lx->base_pos + (cur - 1 - lx->base) - lx->line_pos + 1);
+                tstart = cur - 1;
+                break;
+
+            // EOF
+            case STATE_EOF:
+                TOKEN(SYM_NULL, "", 0);
+
+            // 单字符符号
+            case STATE_SINGLE:
+                sym = single_sym[ch];
+                text = single_text[ch];
+                GETCH();
+                TOKEN(sym, text, 1);
+
+            // 错误符号
+            case STATE_ILLEGAL:
+                // UTF-8 模式下输入已校验：非 ASCII 字符连同后续字节整个作为一个错误 token
+                if (lx->utf8 && ch >= 0xc0) {
+                    ch = *cur++;
+                    while (1) {
+                        if (ch == '\0' && AT_BLOCK_END()) {
+                            SPILL_NEXT_BLOCK();
+                            continue;
+                        }
+                        if ((ch & 0xc0) != 0x80) break;
+                        ch = *cur++;
+                    }
+                    SLICE(SYM_ERROR, CH_POS());
+                }
+                // 非法字符 —— 使用原始字符
+                text = single_text[ch];
+                GETCH();
+                TOKEN(SYM_ERROR, text, 1);
+
+            // <, <=, <>
+            case STATE_INLES:
+                GETCH();
+                if (ch == '=') {
+                    GETCH();
+                    TOKEN(SYM_LEQ, "<=", 2);
+                }
+                if (ch == '>') {
+                    GETCH();
+                    TOKEN(SYM_NEQ, "<>", 2);
+                }
+                TOKEN(SYM_LES, "<", 1);
+
+            // >, >=
+            case STATE_INGTR:
+                GETCH();
+                if (ch == '=') {
+                    GETCH();
+                    TOKEN(SYM_GEQ, ">=", 2);
+                }
+                TOKEN(SYM_GTR, ">", 1);
+
+            // 以下几个循环直接在块内扫描：标识符、注释、字符串交给向量内核，
+            // 扫描范围止于块末 lim，读到哨兵 '\0' 查表得到 STATE_NUL，
+            // 再判断是否需要换块
+
+            //=========================
+            //     标识符状态
+            //=========================
+            case STATE_INID:
+                while (1) {
+                    if (dfa_trans[STATE_INID][CLASS_OF(ch)] == STATE_INID && k < lx->max_id) {
+                        // ch 就在 cur - 1 处；短标识符逐字节扫描更快，超过 8 个字符再交给向量内核。
+                        // 逐字节扫描的同时沿关键字 trie 前进，扫完即知是否为保留字，不必再查表比较。
+                        // trie 状态跨块保留，关键字被块边界切开也能认出
+                        const unsigned char *start = cur - 1;
+                        const unsigned char *end = cur;
+                        kw = kw_trie[kw][ch];
+                        while (end < lim && end - start < 8
+                               && dfa_trans[STATE_INID][CLASS_OF(*end)] == STATE_INID)
+                            kw = kw_trie[kw][*end++];
+                        if (end - start >= 8) {
+                            const unsigned char *p = end;
+                            end = lex_span_alnum(end, lim);
+                            // 最长的关键字（procedure）9 个字符，这里一般一两步就进入死状态
+                            while (kw && p < end) kw = kw_trie[kw][*p++];
+                        }
+                        size_t n = end - start;
+                        if (n > lx->max_id - k) n = lx->max_id - k;
+                        k += n;
+                        cur = start + n;
+                        ch = *cur++;
+                    }
+                    if (ch != '\0' || !AT_BLOCK_END()) break;
+                    SPILL_NEXT_BLOCK();
+                }
+                // 截断兼容模式下被截掉的部分也走了 trie，不影响结果：
+                // 截断后仍有 MAX_ID_LEN - 1 个字符，比任何关键字都长，trie 早已是死状态
+                SLICE(kw_accept[kw] ? kw_accept[kw] : SYM_IDENTIFIER, CH_POS());
+
+            //=========================
+            //     数字状态
+            //=========================
+            case STATE_INNUM:
+                while (1) {
+                    // 边扫描边累加；溢出只记一个标志，循环里没有额外的分支
+                    while (dfa_trans[STATE_INNUM][CLASS_OF(ch)] == STATE_INNUM && k < lx->max_num) {
+                        overflow |= __builtin_mul_overflow(value, 10, &value);
+                        overflow |= __builtin_add_overflow(value, ch - '0', &value);
+                        k++;
+                        ch = *cur++;
+                    }
+                    if (ch != '\0' || !AT_BLOCK_END()) break;
+                    SPILL_NEXT_BLOCK();
+                }
+                // 数字后接字母 -> 错误
+                if (dfa_trans[STATE_INNUM][CLASS_OF(ch)] == STATE_INBADNUM) {
+                    state = STATE_INBADNUM;
+                    break;
+                }
+                SLICE(overflow ? SYM_ERROR : SYM_NUMBER, CH_POS());
+
+            case STATE_INBADNUM:
+                while (dfa_trans[STATE_INBADNUM][CLASS_OF(ch)] == STATE_INBADNUM && k < lx->max_num) {
+                    k++;
+                    ch = *cur++;
+                    if (ch == '\0' && AT_BLOCK_END()) SPILL_NEXT_BLOCK();
+                }
+                SLICE(SYM_ERROR, CH_POS());
+
+            //=========================
+            //     :=
+            //=========================
+            case STATE_INASSIGN:
+                GETCH();
+                if (ch == '=') {
+                    GETCH();
+                    TOKEN(SYM_ASSIGN, ":=", 2);
+                }
+                TOKEN(SYM_ERROR, ":", 1);
+
+            //=========================
+            //     注释 { ... }
+            //=========================
+            case STATE_INCOMMENT:
+                GETCH(); // 跳过 {
+                while (1) {
+                    while ((state = dfa_trans[STATE_INCOMMENT][CLASS_OF(ch)]) == STATE_INCOMMENT) {
+                        cur = lex_find2(cur, lim, '}', '\n');
+                        ch = *cur++;
+                    }
+                    if (state != STATE_NUL) break;
+                    if (AT_BLOCK_END())
+                        NEXT_BLOCK();
+                    else
+                        ch = *cur++;    // 注释中真实的 NUL 字节
+                }
+                if (state == STATE_ERROR)
+                    TOKEN(SYM_ERROR, "=== Unclosed comment ===", 24);
+                GETCH(); // 跳过 }
+                break;   // state == STATE_START
+
+            //=========================
+            //     字符串
+            //=========================
+            case STATE_INSTRING:
+                GETCH(); // 跳过开头 "
+                tstart = CH_POS();
+                while (1) {
+                    while ((state = dfa_trans[STATE_INSTRING][CLASS_OF(ch)]) == STATE_INSTRING
+                           && k < lx->max_str) {
+                        const unsigned char *start = cur - 1;
+                        size_t n = lex_find2(cur, lim, '"', '\n') - start;
+                        if (n > lx->max_str - k) n = lx->max_str - k;
+                        k += n;
+                        cur = start + n;
+                        ch = *cur++;
+                    }
+                    if (state != STATE_NUL) break;
+                    if (AT_BLOCK_END()) {
+                        SPILL_NEXT_BLOCK();
+                        continue;
+                    }
+                    if (k >= lx->max_str) break;
+                    k++;                    // 字符串中真实的 NUL 字节
+                    ch = *cur++;
+                }
+                if (state != STATE_DONE)      // 未闭合
+                    TOKEN(SYM_ERROR, "=== Unclosed string ===", 23);
+                tend = cur - 1;
+                GETCH(); // 跳过 "
+                SLICE(SYM_STRING, tend);
+
+            default:
+                state = STATE_ERROR;
+                break;
+        } // end switch
+    } // end while
+
+    sym = SYM_ERROR;
+    text = "unknown";
+    k = 7;
+
+out:
+    lx->text_len = lx->tok_start;   // 丢掉未成词素的已拷出部分（如跨块的未闭合字符串）
+    goto done;
+
+slice:
+    if (lx->blocks) {
+        // 流式输入：拷到存放区，以 '\0' 结尾
+        if (text_append(lx, tstart, tend - tstart) != 0 || text_append(lx, "", 1) != 0)
+            goto oom;
+        text = lx->text->data + lx->tok_start;
+        k = lx->text_len - lx->tok_start - 1;
+        lx->tok_start = lx->text_len;
+    } else {
+        text = (const char *)tstart;
+        k = tend - tstart;
+    }
+done:
+#ifdef PL0_LEX_STATS
+    prof_leave(lx, prof_state, &prof_pos, PROF_POS(), prof_sample ? &prof_tsc : NULL);
+    if (sym != SYM_NULL) {
+        lx->stats.tokens[sym]++;
+        lx->stats.lexeme_bytes[sym] += k;
+        if (sym == SYM_ERROR) lx->stats.errors[prof_error_kind(prof_state, k)]++;
+    }
+#endif
+    tok->sym = sym;
+    tok->text = text;
+    tok->len = k;
+    tok->id = 0;
+    tok->value = sym == SYM_NUMBER ? value : 0;
+    lx->cur = cur;
+    lx->lim = lim;
+    lx->ch = ch;
+    lx->line = line;
+    return sym;
+
+oom:
+    lx->error = PL0_LEX_ENOMEM;
+    return SYM_NULL;
+}
+
+size_t pl0_lex_batch(pl0_lexer *lx, pl0_token *toks, size_t cap) {
+    if (lx->error) return 0;
+
+    // 上一批拷出的词素到此失效
+    free_text_blocks(lx->retired);
+    lx->retired = NULL;
+    lx->text_len = lx->tok_start = 0;
+
+    size_t n = 0;
+    while (n < cap) {
+        pl0_token *t = &toks[n];
+        int sym = lex_one(lx, t);
+        if (sym == SYM_NULL) break;
+        if (lx->intern && (sym == SYM_IDENTIFIER || sym == SYM_STRING)) {
+            t->id = intern(lx->intern, t->text, t->len);
+            if (!t->id) {
+                lx->error = PL0_LEX_ENOMEM;
+                return 0;
+            }
+            t->text = intern_str(lx->intern, t->id);
+        }
+        n++;
+    }
+    return lx->error ? 0 : n;
+}
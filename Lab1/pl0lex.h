@@ -0,0 +1,163 @@
+#ifndef PL0LEX_H
+#define PL0LEX_H
+
+// 可重入的 PL/0 词法分析器
+//
+//     pl0_lexer *lx = pl0_lexer_open("a.pl0");
+//     pl0_token toks[256];
+//     size_t n;
+//     while ((n = pl0_lex_batch(lx, toks, 256)) > 0)
+//         for (size_t i = 0; i < n; i++) ... toks[i] ...
+//     pl0_lexer_close(lx);
+//
+// 全部状态都在 pl0_lexer 中，不同线程可各自持有一个分析器同时工作。
+// 一次取一批 token，调用开销摊到几百个 token 上。
+//
+// 非 ASCII 字节（>= 0x80）的处理与 locale 无关：
+//   注释中      与其他字符一样跳过
+//   字符串中    原样作为 SYM_STRING 词素的一部分，len 按字节计
+//   其他位置    非法字符；默认每个字节一个 SYM_ERROR，
+//               UTF-8 模式（pl0_lexer_set_utf8）下每个字符（整个多字节序列）一个 SYM_ERROR
+// UTF-8 模式下输入先经校验，不合法的输入整体拒绝，不会逐字节报错；
+// 通过校验后所有词素都是完整的 UTF-8 字符序列。
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// 自带种别码定义的程序（如 Lab2 / Lab3 的语法分析器）先定义 PL0LEX_NO_SYM 再包含本文件
+#ifndef PL0LEX_NO_SYM
+#include "pl0_sym.h"
+#endif
+#include "pl0_loc.h"
+#include "intern.h"
+
+// pl0_lexer_error() 的返回值
+#define PL0_LEX_ENOMEM 1    // 内存不足
+#define PL0_LEX_EUTF8  2    // UTF-8 模式下输入不合法，位置见 pl0_lexer_error_loc()
+
+// 截断兼容模式（pl0_lexer_set_truncate）下的词素长度上限，含结尾 '\0'
+#define MAX_ID_LEN  50
+#define MAX_NUM_LEN 50
+#define MAX_STR_LEN 200
+
+// 词素 text 的来源与有效期：
+//   映射 / 内存输入  直接指向源程序中的那一段，不拷贝、不以 '\0' 结尾，
+//                    长度看 len；分析器关闭（内存输入为数据释放）前有效
+//   流式输入        拷到分析器内的存放区，以 '\0' 结尾；下一次调用 pl0_lex_batch 之前有效
+//   已驻留          指向驻留表，以 '\0' 结尾；驻留表销毁前有效
+// 固定拼写的 token（关键字除外）指向静态字符串。
+// 词素中可能含有 NUL 字节（非法字符、字符串内容），一律以 len 为准
+//
+// 数字在扫描时即转换成 value，后续阶段不必再解析数字串；
+// 超过 INT64_MAX 的数字记为 SYM_ERROR，词素仍为原来的数字串
+typedef struct {
+    int sym;                // 种别码 SYM_*
+    pl0_loc loc;            // 第一个字符所在的行、列
+    int64_t value;          // SYM_NUMBER 的值，其他 token 为 0
+    uint32_t len;           // 词素长度
+    uint32_t id;            // 标识符 / 字符串的符号 ID，未驻留时为 0
+    const char *text;       // 词素，见上
+} pl0_token;
+
+// 文本输出时词素的长度：到第一个 NUL 为止，与原来 printf("%s") 的结果一致。
+// lexer_manual 的各种输出与 lexdiff 都按此截断，比较时才不会在含 NUL 的 token 上误报
+static inline size_t pl0_print_len(const pl0_token *t) {
+    const char *z = memchr(t->text, '\0', t->len);
+    return z ? (size_t)(z - t->text) : t->len;
+}
+
+typedef struct pl0_lexer pl0_lexer;
+
+// 打开源文件；path 为 NULL 或 "-" 时读取标准输入。失败返回 NULL
+pl0_lexer *pl0_lexer_open(const char *path);
+// 从已打开的描述符读取，关闭分析器时不会关闭 fd
+pl0_lexer *pl0_lexer_open_fd(int fd);
+// 分析内存中的 [data, data + len)，不拷贝。要求 data[len] 可读且为 '\0'
+pl0_lexer *pl0_lexer_open_mem(const char *data, size_t len);
+void pl0_lexer_close(pl0_lexer *lx);
+
+// 把标识符和字符串驻留到 tab 中（见 intern.h），token 中带上符号 ID。
+// tab 归调用方所有，可由多个分析器共用，但不能跨线程同时使用
+void pl0_lexer_set_intern(pl0_lexer *lx, intern_table *tab);
+
+// 按原来的规则截断过长的词素：标识符、数字最多 MAX_ID_LEN - 1 / MAX_NUM_LEN - 1 个字符，
+// 超出部分作为下一个 token；字符串超过 MAX_STR_LEN - 1 个字符按未闭合报错。
+// 默认不截断，词素多长都原样返回
+void pl0_lexer_set_truncate(pl0_lexer *lx, int on);
+
+// UTF-8 模式：要求输入是合法的 UTF-8，须在第一次 pl0_lex_batch 之前打开。
+// 映射 / 内存输入在此一次校验完毕，不合法返回 -1，之后 pl0_lex_batch 直接返回 0；
+// 流式输入每读入一块校验一块（跨块的字符接起来校验），不合法时在读到那一块的批次报错，
+// 此前各批的 token 已经交出
+int pl0_lexer_set_utf8(pl0_lexer *lx, int on);
+// 同上，但不做校验：调用方保证输入已经整体校验过（如并行分析前对整个文件的一次校验）。
+// 输入实际不合法时不会报错，非 ASCII 首字节连同其后的续字节照样成词
+void pl0_lexer_set_utf8_trusted(pl0_lexer *lx, int on);
+
+// 取出至多 cap 个 token 存入 toks，返回实际个数；返回 0 表示输入结束。
+// 出错（内存不足、UTF-8 不合法）时返回 0 并置 pl0_lexer_error()
+size_t pl0_lex_batch(pl0_lexer *lx, pl0_token *toks, size_t cap);
+// 0 或 PL0_LEX_*
+int pl0_lexer_error(const pl0_lexer *lx);
+// PL0_LEX_EUTF8 时第一个不合法序列的位置
+pl0_loc pl0_lexer_error_loc(const pl0_lexer *lx);
+// 当前读到的行号；输入结束后为 1 + 已读过的换行数
+uint32_t pl0_lexer_line(const pl0_lexer *lx);
+// 是否为流式输入，即未驻留的词素只在下一次 pl0_lex_batch 之前有效
+int pl0_lexer_is_stream(const pl0_lexer *lx);
+
+#ifdef PL0_LEX_STATS
+//=========================
+//     计数器
+//=========================
+// 编译时定义 PL0_LEX_STATS 才有，不定义时分析器中没有任何统计代码。
+// 各分析器分别计数，pl0_lexer_add_stats 把一个分析器的计数累加到 sum 中
+#define PL0_LEX_NSYMS    101    // 种别码 0 .. SYM_ERROR
+#define PL0_LEX_NSTATES  15     // DFA 状态数
+#define PL0_LEX_SAMPLE   64     // 每 64 个 token 抽一个记周期数
+
+// 出错 token 的类别，按产出它的状态区分
+enum {
+    PL0_LEX_ERR_ILLEGAL,        // 非法字符（含单独的 }）
+    PL0_LEX_ERR_UTF8_CHAR,      // UTF-8 模式下的非 ASCII 字符
+    PL0_LEX_ERR_BADNUM,         // 数字后接字母
+    PL0_LEX_ERR_OVERFLOW,       // 数字超过 INT64_MAX
+    PL0_LEX_ERR_COLON,          // 单独的 :
+    PL0_LEX_ERR_COMMENT,        // 未闭合的注释
+    PL0_LEX_ERR_STRING,         // 未闭合的字符串
+    PL0_LEX_ERR_OTHER,
+    PL0_LEX_ERR_COUNT
+};
+
+typedef struct {
+    uint64_t tokens[PL0_LEX_NSYMS];             // 各种别的 token 数
+    uint64_t lexeme_bytes[PL0_LEX_NSYMS];       // 各种别的词素长度之和
+    uint64_t errors[PL0_LEX_ERR_COUNT];         // 各类出错 token 数
+    uint64_t state_visits[PL0_LEX_NSTATES];     // 进入各状态的次数
+    uint64_t state_bytes[PL0_LEX_NSTATES];      // 各状态读过的输入字节数
+    // 抽样的 token 在各状态中的周期数（x86 上用 TSC，其他平台为 0）、进入次数与字节数
+    uint64_t sampled_tokens;
+    uint64_t state_cycles[PL0_LEX_NSTATES];
+    uint64_t state_sampled_visits[PL0_LEX_NSTATES];
+    uint64_t state_sampled_bytes[PL0_LEX_NSTATES];
+} pl0_lex_stats;
+
+void pl0_lexer_add_stats(const pl0_lexer *lx, pl0_lex_stats *sum);
+// 状态 / 出错类别的名字，超出范围返回 NULL
+const char *pl0_lex_state_name(int state);
+const char *pl0_lex_error_name(int kind);
+#endif
+
+// 校验 [p, p + len) 是否为合法的 UTF-8（RFC 3629，拒绝超长编码、代理项和超过 U+10FFFF 的码点）。
+// 合法返回 len，否则返回第一个不合法（或在末尾不完整）的序列的起点偏移。
+// ASCII 部分按 SIMD 组判断，以 ASCII 为主的源程序接近内存带宽
+size_t pl0_utf8_check(const char *p, size_t len);
+
+// 把普通文件整个映射到内存（私有可写，改动不会写回文件），
+// 文件内容之后保证至少有一个 '\0'，可直接交给 pl0_lexer_open_mem。
+// 无法映射（管道、终端、空文件等）时返回 NULL
+char *pl0_map_fd(int fd, size_t *size, size_t *map_len);
+void pl0_unmap(char *p, size_t map_len);
+
+#endif
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pl0look.h"
+
+#define BATCH_SIZE  64              // 每次补充时至少能取出的 token 数
+
+// 流式输入时槽位自己的词素副本，只增不减，槽位复用时接着用
+typedef struct {
+    char *buf;
+    uint32_t cap;
+} look_text;
+
+struct pl0_look {
+    pl0_lexer *lx;
+    pl0_token *toks;            // 容量为 mask + 1（2 的幂），序号 n 的 token 在 toks[n & mask]
+    look_text *texts;           // 流式输入时与 toks 一一对应，否则为 NULL
+    size_t mask;
+    size_t head, tail;          // [head, tail) 为已分析、尚未取走的 token
+    size_t depth;               // k
+    int eof;                    // 分析器已返回 0，不再补充
+    int error;                  // 拷贝词素时内存不足
+    pl0_token end;              // 输入结束后 peek 返回的空 token
+};
+
+pl0_look *pl0_look_open(pl0_lexer *lx, size_t k) {
+    if (k == 0) return NULL;
+    pl0_look *la = calloc(1, sizeof(pl0_look));
+    if (!la) return NULL;
+
+    // 需要补充时缓冲区中不到 k 个 token，容量至少 k + BATCH_SIZE 才能保证每次补一整批
+    size_t cap = BATCH_SIZE;
+    while (cap < k + BATCH_SIZE) cap *= 2;
+    la->toks = malloc(cap * sizeof(pl0_token));
+    if (pl0_lexer_is_stream(lx)) la->texts = calloc(cap, sizeof(look_text));
+    if (!la->toks || (pl0_lexer_is_stream(lx) && !la->texts)) {
+        pl0_look_close(la);
+        return NULL;
+    }
+    la->lx = lx;
+    la->mask = cap - 1;
+    la->depth = k;
+    la->end.text = "";
+    return la;
+}
+
+void pl0_look_close(pl0_look *la) {
+    if (!la) return;
+    if (la->texts)
+        for (size_t i = 0; i <= la->mask; i++) free(la->texts[i].buf);
+    free(la->texts);
+    free(la->toks);
+    free(la);
+}
+
+// 把 toks[at, at + n) 中未驻留的词素拷到各自槽位，下一批之后仍然有效
+static int keep_text(pl0_look *la, size_t at, size_t n) {
+    for (size_t i = at; i < at + n; i++) {
+        pl0_token *t = &la->toks[i];
+        if (t->id) continue;            // 驻留表中的词素一直有效
+        look_text *s = &la->texts[i];
+        if (s->cap < t->len + 1) {
+            uint32_t cap = s->cap ? s->cap : 16;
+            while (cap < t->len + 1) cap *= 2;
+            char *p = realloc(s->buf, cap);
+            if (!p) return -1;
+            s->buf = p;
+            s->cap = cap;
+        }
+        memcpy(s->buf, t->text, t->len);
+        s->buf[t->len] = '\0';
+        t->text = s->buf;
+    }
+    return 0;
+}
+
+// 用空闲槽位补充 token。空闲区在环尾绕回时分两段，各取一批
+static void refill(pl0_look *la) {
+    size_t room = la->mask + 1 - (la->tail - la->head);
+    while (room > 0 && !la->eof) {
+        size_t at = la->tail & la->mask;
+        size_t n = la->mask + 1 - at;
+        if (n > room) n = room;
+        size_t got = pl0_lex_batch(la->lx, la->toks + at, n);
+        if (got == 0 || (la->texts && keep_text(la, at, got) != 0)) {
+            if (got) la->error = PL0_LEX_ENOMEM;
+            la->eof = 1;
+            return;
+        }
+        la->tail += got;
+        room -= got;
+        if (got < n) return;    // 这一批没取满，输入已到末尾，下次补充时再确认
+    }
+}
+
+const pl0_token *pl0_look_peek(pl0_look *la, size_t i) {
+    if (i >= la->depth) return NULL;
+    if (i >= la->tail - la->head) {
+        refill(la);
+        if (i >= la->tail - la->head) return &la->end;
+    }
+    return &la->toks[(la->head + i) & la->mask];
+}
+
+void pl0_look_consume(pl0_look *la) {
+    if (la->head == la->tail) {
+        refill(la);
+        if (la->head == la->tail) return;
+    }
+    la->head++;
+}
+
+int pl0_look_error(const pl0_look *la) {
+    return la->error ? la->error : pl0_lexer_error(la->lx);
+}
@@ -0,0 +1,38 @@
+#ifndef PL0LOOK_H
+#define PL0LOOK_H
+
+// 向前看 k 个 token 的环形缓冲，供语法分析器代替逐个 getsym
+//
+//     pl0_look *la = pl0_look_open(lx, 2);
+//     if (pl0_look_peek(la, 0)->sym == SYM_IDENTIFIER && pl0_look_peek(la, 1)->sym == SYM_ASSIGN) ...
+//     pl0_look_consume(la);
+//     pl0_look_close(la);
+//
+// 缓冲区容量固定，token 不够时一次用 pl0_lex_batch 填满空闲的槽位，
+// 调用开销仍摊到一批 token 上。LL(k) 的选择和出错后的同步都只看缓冲区，
+// 不必回退输入、也不必重新分析。
+//
+// 流式输入的词素只在下一批之前有效，缓冲区为每个槽位各留一份副本（已驻留的除外），
+// 所以 peek 得到的 token 在它被 consume 之前一直有效，与输入方式无关。
+
+#include <stddef.h>
+
+#include "pl0lex.h"
+
+typedef struct pl0_look pl0_look;
+
+// 在 lx 上建立缓冲区，最多可向前看 k 个 token（k >= 1）。lx 仍归调用方所有，
+// 之后不要再直接调用 pl0_lex_batch。失败返回 NULL
+pl0_look *pl0_look_open(pl0_lexer *lx, size_t k);
+void pl0_look_close(pl0_look *la);
+
+// 当前 token 之后的第 i 个（i = 0 为当前 token），要求 i < k，否则返回 NULL。
+// 输入结束（或出错）之后返回 sym 为 0（SYM_NULL）、loc 为 0 的空 token
+const pl0_token *pl0_look_peek(pl0_look *la, size_t i);
+// 取走当前 token；输入已结束时什么也不做
+void pl0_look_consume(pl0_look *la);
+
+// 0 或 PL0_LEX_*：分析器出错，或缓冲区拷贝词素时内存不足
+int pl0_look_error(const pl0_look *la);
+
+#endif
@@ -0,0 +1,298 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pl0_sym.h"
+#include "tokbin.h"
+
+//=========================
+//     写入端
+//=========================
+void tokbin_writer_init(tokbin_writer *w) {
+    memset(w, 0, sizeof(*w));
+}
+
+// 拼写固定、可以共用字符串表项的 token
+static int is_fixed_kind(int kind) {
+    return kind > SYM_NUMBER && kind < 128 && kind != SYM_STRING && kind != SYM_ERROR;
+}
+
+// 记录数、字符串表长度都是 32 位，容量超过 2^31 时翻倍会溢出，直接拒绝
+static int grow(void **p, uint32_t *cap, uint64_t need, size_t elem) {
+    if (need <= *cap) return 0;
+    if (need > UINT32_MAX / 2) return -1;
+    uint32_t ncap = *cap ? *cap : 1024;
+    while (ncap < need) ncap *= 2;
+    void *np = realloc(*p, (size_t)ncap * elem);
+    if (!np) return -1;
+    *p = np;
+    *cap = ncap;
+    return 0;
+}
+
+int tokbin_put(tokbin_writer *w, int kind, const char *text, uint32_t len, pl0_loc loc, uint32_t id,
+               int64_t value) {
+    if (grow((void **)&w->recs, &w->rec_cap, (uint64_t)w->ntokens + 1, sizeof(tokbin_rec)) != 0)
+        return -1;
+    if (id) {
+        uint32_t old = w->sym_cap;
+        if (grow((void **)&w->sym_off, &w->sym_cap, (uint64_t)id + 1, sizeof(uint32_t)) != 0)
+            return -1;
+        memset(w->sym_off + old, 0, (size_t)(w->sym_cap - old) * sizeof(uint32_t));
+    }
+
+    uint32_t off;
+    if (is_fixed_kind(kind) && w->fixed_off[kind]) {
+        off = w->fixed_off[kind] - 1;
+    } else if (id && w->sym_off[id]) {
+        off = w->sym_off[id] - 1;
+    } else {
+        if (grow((void **)&w->strtab, &w->strtab_cap, (uint64_t)w->strtab_len + len + 1, 1) != 0)
+            return -1;
+        off = w->strtab_len;
+        memcpy(w->strtab + off, text, len);
+        w->strtab[off + len] = '\0';
+        w->strtab_len += len + 1;
+        if (is_fixed_kind(kind)) w->fixed_off[kind] = off + 1;
+        else if (id) w->sym_off[id] = off + 1;
+    }
+
+    tokbin_rec *r = &w->recs[w->ntokens++];
+    r->kind = kind;
+    r->offset = off;
+    r->length = len;
+    r->id = id;
+    r->loc = loc;
+    r->value = value;
+    return 0;
+}
+
+// 按记录格式编码 token r，prev_line 为前一个 token 的行号。返回写入 e 的记录数（1 ~ 3）
+static int encode(const tokbin_rec *r, uint32_t prev_line, tokbin_entry *e) {
+    uint32_t dline = PL0_LINE(r->loc) - prev_line;
+    uint32_t col = PL0_COL(r->loc);
+    int n = 0;
+    if (dline > UINT8_MAX) {
+        e[n].kind = TOKBIN_EXT_LINE;
+        e[n].dline = 0;
+        e[n].col = 0;
+        e[n++].ref = dline;
+        dline = 0;
+    }
+    if (col > UINT16_MAX) {
+        e[n].kind = TOKBIN_EXT_COL;
+        e[n].dline = 0;
+        e[n].col = 0;
+        e[n++].ref = col;
+        col = 0;
+    }
+    e[n].kind = r->id ? r->kind | TOKBIN_REF_ID : r->kind;
+    e[n].dline = dline;
+    e[n].col = col;
+    e[n++].ref = r->id ? r->id : r->offset;
+    return n;
+}
+
+// 把 n 段记录依次写成一个流，各段的 offset 已指向拼接后的字符串表
+static int write_stream(const tokbin_writer *parts, size_t n, FILE *fp) {
+    tokbin_entry buf[1024 + 3];
+
+    // 合起来超出 32 位的记录数 / 字符串表长度无法写成一个流
+    uint64_t ntok = 0, nent = 0, nstr = 0;
+    uint32_t max_id = 0, line = 0;
+    for (size_t i = 0; i < n; i++) {
+        const tokbin_writer *w = &parts[i];
+        for (uint32_t k = 0; k < w->ntokens; k++) {
+            nent += encode(&w->recs[k], line, buf);
+            line = PL0_LINE(w->recs[k].loc);
+            if (w->recs[k].id > max_id) max_id = w->recs[k].id;
+        }
+        ntok += w->ntokens;
+        nstr += w->strtab_len;
+    }
+    if (ntok > UINT32_MAX || nent > UINT32_MAX || nstr > UINT32_MAX || max_id == UINT32_MAX) return -1;
+
+    tokbin_header h;
+    memcpy(h.magic, TOKBIN_MAGIC, 4);
+    h.version = TOKBIN_VERSION;
+    h.ntokens = ntok;
+    h.nentries = nent;
+    h.strtab_len = nstr;
+    h.nsyms = max_id ? max_id + 1 : 0;
+
+    uint32_t *symtab = calloc((size_t)h.nsyms + 1, sizeof(uint32_t));
+    if (!symtab) return -1;
+    for (size_t i = 0; i < n; i++)
+        for (uint32_t k = 0; k < parts[i].ntokens; k++)
+            if (parts[i].recs[k].id) symtab[parts[i].recs[k].id] = parts[i].recs[k].offset;
+
+    int err = fwrite(&h, sizeof(h), 1, fp) != 1;
+    for (size_t i = 0; i < n && !err; i++)
+        err = parts[i].strtab_len && fwrite(parts[i].strtab, 1, parts[i].strtab_len, fp) != parts[i].strtab_len;
+    if (!err && h.nsyms) err = fwrite(symtab, sizeof(uint32_t), h.nsyms, fp) != h.nsyms;
+    free(symtab);
+
+    // 记录攒满一批再写
+    size_t used = 0;
+    line = 0;
+    for (size_t i = 0; i < n && !err; i++) {
+        const tokbin_writer *w = &parts[i];
+        for (uint32_t k = 0; k < w->ntokens && !err; k++) {
+            used += encode(&w->recs[k], line, buf + used);
+            line = PL0_LINE(w->recs[k].loc);
+            if (used >= 1024) {
+                err = fwrite(buf, sizeof(tokbin_entry), used, fp) != used;
+                used = 0;
+            }
+        }
+    }
+    if (!err && used) err = fwrite(buf, sizeof(tokbin_entry), used, fp) != used;
+    if (err) return -1;
+    return fflush(fp) == 0 ? 0 : -1;
+}
+
+int tokbin_write(tokbin_writer *w, FILE *fp) {
+    return write_stream(w, 1, fp);
+}
+
+int tokbin_write_parts(tokbin_writer *parts, size_t n, FILE *fp) {
+    // 合起来超出 32 位的字符串表无法写成一个流，先检查再改 offset
+    uint64_t nstr = 0;
+    for (size_t i = 0; i < n; i++) nstr += parts[i].strtab_len;
+    if (nstr > UINT32_MAX) return -1;
+
+    uint32_t base = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (uint32_t k = 0; k < parts[i].ntokens; k++)
+            parts[i].recs[k].offset += base;
+        base += parts[i].strtab_len;
+    }
+    return write_stream(parts, n, fp);
+}
+
+void tokbin_writer_free(tokbin_writer *w) {
+    free(w->recs);
+    free(w->sym_off);
+    free(w->strtab);
+    memset(w, 0, sizeof(*w));
+}
+
+int tokbin_write_file_mark(FILE *fp, const char *path) {
+    tokbin_file_header h;
+    memcpy(h.magic, TOKBIN_FILE_MAGIC, 4);
+    h.path_len = strlen(path);
+    if (fwrite(&h, sizeof(h), 1, fp) != 1) return -1;
+    return fwrite(path, 1, h.path_len, fp) == h.path_len ? 0 : -1;
+}
+
+//=========================
+//     读取端
+//=========================
+int tokbin_is_magic(const void *p) {
+    return memcmp(p, TOKBIN_MAGIC, 4) == 0;
+}
+
+int tokbin_read(FILE *fp, tokbin *tb) {
+    tokbin_header h;
+    tokbin_entry buf[1024];
+    uint32_t *symtab = NULL, *symlen = NULL;
+    memset(tb, 0, sizeof(*tb));
+
+    if (fread(&h, sizeof(h), 1, fp) != 1) return -1;
+    if (!tokbin_is_magic(h.magic) || h.version != TOKBIN_VERSION) return -1;
+
+    tb->recs = malloc((size_t)h.ntokens * sizeof(tokbin_rec) + 1);
+    tb->strtab = malloc((size_t)h.strtab_len + 1);
+    symtab = malloc((size_t)h.nsyms * sizeof(uint32_t) + 1);
+    symlen = malloc((size_t)h.nsyms * sizeof(uint32_t) + 1);
+    if (!tb->recs || !tb->strtab || !symtab || !symlen) goto fail;
+
+    if (fread(tb->strtab, 1, h.strtab_len, fp) != h.strtab_len) goto fail;
+    tb->strtab[h.strtab_len] = '\0';
+    tb->strtab_len = h.strtab_len;
+    if (fread(symtab, sizeof(uint32_t), h.nsyms, fp) != h.nsyms) goto fail;
+    // 每个符号的长度只算一次；没用到的表项可能是 0 偏移的占位，引用到时才报错
+    for (uint32_t id = 0; id < h.nsyms; id++)
+        symlen[id] = symtab[id] < h.strtab_len ? strlen(tb->strtab + symtab[id]) : UINT32_MAX;
+
+    uint32_t ntok = 0, line = 0, ext_line = 0, ext_col = 0;
+    int has_line = 0, has_col = 0;
+    for (uint32_t left = h.nentries; left > 0;) {
+        uint32_t m = left < 1024 ? left : 1024;
+        if (fread(buf, sizeof(tokbin_entry), m, fp) != m) goto fail;
+        left -= m;
+
+        for (uint32_t j = 0; j < m; j++) {
+            const tokbin_entry *e = &buf[j];
+            if (e->kind == TOKBIN_EXT_LINE) {
+                ext_line = e->ref;
+                has_line = 1;
+                continue;
+            }
+            if (e->kind == TOKBIN_EXT_COL) {
+                ext_col = e->ref;
+                has_col = 1;
+                continue;
+            }
+            if (ntok == h.ntokens) goto fail;
+
+            tokbin_rec *r = &tb->recs[ntok++];
+            r->kind = e->kind & ~TOKBIN_REF_ID;
+            if (e->kind & TOKBIN_REF_ID) {
+                // 词素必须完整落在字符串表内
+                if (e->ref >= h.nsyms || symlen[e->ref] == UINT32_MAX) goto fail;
+                r->id = e->ref;
+                r->offset = symtab[e->ref];
+                r->length = symlen[e->ref];
+            } else {
+                if (e->ref >= h.strtab_len) goto fail;
+                r->id = 0;
+                r->offset = e->ref;
+                r->length = strlen(tb->strtab + e->ref);
+            }
+            line += has_line ? ext_line : e->dline;
+            r->loc = PL0_LOC(line, has_col ? ext_col : e->col);
+            has_line = has_col = 0;
+
+            // 数字的词素只含数字，值不超过 int64（否则分析器给出的是错误 token）
+            uint64_t v = 0;
+            if (r->kind == SYM_NUMBER)
+                for (const char *p = tb->strtab + r->offset; *p; p++) v = v * 10 + (uint64_t)(*p - '0');
+            r->value = (int64_t)v;
+        }
+    }
+    if (ntok != h.ntokens) goto fail;
+    tb->ntokens = ntok;
+    free(symtab);
+    free(symlen);
+    return 0;
+
+fail:
+    free(symtab);
+    free(symlen);
+    tokbin_free(tb);
+    return -1;
+}
+
+int tokbin_read_file_mark(FILE *fp, char **path) {
+    tokbin_file_header h;
+    *path = NULL;
+    size_t n = fread(&h, 1, sizeof(h), fp);
+    if (n == 0 && feof(fp)) return 1;
+    if (n != sizeof(h) || memcmp(h.magic, TOKBIN_FILE_MAGIC, 4) != 0) return -1;
+
+    char *p = malloc((size_t)h.path_len + 1);
+    if (!p) return -1;
+    if (fread(p, 1, h.path_len, fp) != h.path_len) {
+        free(p);
+        return -1;
+    }
+    p[h.path_len] = '\0';
+    *path = p;
+    return 0;
+}
+
+void tokbin_free(tokbin *tb) {
+    free(tb->recs);
+    free(tb->strtab);
+    memset(tb, 0, sizeof(*tb));
+}
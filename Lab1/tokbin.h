@@ -0,0 +1,125 @@
+#ifndef TOKBIN_H
+#define TOKBIN_H
+
+// 二进制 token 流格式（lexer_manual -b 输出，Lab2 / Lab3 直接读取）
+//
+//     tokbin_header                 文件头
+//     char strtab[strtab_len]       字符串表，每个词素以 '\0' 结尾
+//     uint32_t symtab[nsyms]        符号表，symtab[id] 为符号 id 的词素在字符串表中的偏移
+//     tokbin_entry[nentries]        8 字节的 token 记录
+//
+// 所有整数按本机字节序存放。拼写固定的 token（关键字、运算符、界符）共用同一份词素；
+// 带符号 ID 的标识符 / 字符串（见 intern.h）每个 ID 也只存一份。
+//
+// 记录只存种别码、与前一个 token 的行差、列号和一个 32 位引用：
+// 种别码带 TOKBIN_REF_ID 时引用符号 ID，否则引用字符串表偏移。
+// 行差或列号放不下时，先写一条 TOKBIN_EXT_LINE / TOKBIN_EXT_COL 记录给出完整的值，
+// 紧随其后的 token 记录中对应的字段不用。
+// 词素长度取到 '\0' 为止，数字的值读入时由词素算出，都不落盘。
+// 读入时展开成定长的 tokbin_rec，使用方按下标随机访问。
+//
+// 多文件合并流（lexer_manual -m -b）由若干帧组成，每个源文件一帧：
+//
+//     tokbin_file_header            帧头
+//     char path[path_len]           源文件路径，不以 '\0' 结尾
+//     上面的单文件 token 流
+//
+// 各帧的符号 ID 在整个流中统一编号，行号各自从 1 开始。
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "pl0_loc.h"
+
+#define TOKBIN_MAGIC   "\x7fP0T"
+#define TOKBIN_VERSION 5
+#define TOKBIN_FILE_MAGIC "\x7fP0F"
+
+typedef struct {
+    char magic[4];          // TOKBIN_MAGIC
+    uint32_t version;       // TOKBIN_VERSION
+    uint32_t ntokens;       // token 数
+    uint32_t nentries;      // 记录数，含扩展记录
+    uint32_t strtab_len;    // 字符串表字节数
+    uint32_t nsyms;         // 符号表项数（最大符号 ID + 1）
+} tokbin_header;
+
+typedef struct {
+    char magic[4];          // TOKBIN_FILE_MAGIC
+    uint32_t path_len;      // 路径字节数
+} tokbin_file_header;
+
+#define TOKBIN_REF_ID   0x80    // 记录引用符号 ID
+#define TOKBIN_EXT_COL  0x7e    // 扩展记录：ref 为下一个 token 的列号
+#define TOKBIN_EXT_LINE 0x7f    // 扩展记录：ref 为下一个 token 与前一个 token 的行差
+
+typedef struct {
+    uint8_t kind;           // 种别码 SYM_* 或 TOKBIN_EXT_*，可带 TOKBIN_REF_ID
+    uint8_t dline;          // 与前一个 token 的行差
+    uint16_t col;           // 列号
+    uint32_t ref;           // 符号 ID / 词素在字符串表中的偏移 / 扩展记录的值
+} tokbin_entry;
+
+// 内存中的 token 记录（写入端收集、读取端展开）
+typedef struct {
+    uint32_t kind;          // 种别码 SYM_*
+    uint32_t offset;        // 词素在字符串表中的偏移
+    uint32_t length;        // 词素长度（不含结尾 '\0'）
+    uint32_t id;            // 符号 ID，相同的标识符 / 字符串 ID 相同；0 表示无
+    pl0_loc loc;            // 所在行、列（见 pl0_loc.h）
+    int64_t value;          // 数字的值，其他 token 为 0
+} tokbin_rec;
+
+//=========================
+//     写入端
+//=========================
+typedef struct {
+    tokbin_rec *recs;
+    uint32_t ntokens, rec_cap;
+    char *strtab;
+    uint32_t strtab_len, strtab_cap;
+    uint32_t fixed_off[128];    // 拼写固定的 token 已存入字符串表的位置，0 表示尚未存入
+    uint32_t *sym_off;          // sym_off[id]：符号已存入字符串表的位置，0 表示尚未存入
+    uint32_t sym_cap;
+} tokbin_writer;
+
+void tokbin_writer_init(tokbin_writer *w);
+// 追加一个 token，id 为符号 ID（没有则传 0），value 为数字的值。
+// 内存不足，或记录数 / 字符串表超过 2^31 时返回 -1
+int tokbin_put(tokbin_writer *w, int kind, const char *text, uint32_t len, pl0_loc loc, uint32_t id,
+               int64_t value);
+// 把整个 token 流写到 fp，失败返回 -1
+int tokbin_write(tokbin_writer *w, FILE *fp);
+// 把 n 段 token 流按顺序拼成一个写到 fp（并行分析各块分别写入），失败（含合计超出 32 位）返回 -1。
+// 各段记录中的 offset 会被就地改为拼接后字符串表中的位置
+int tokbin_write_parts(tokbin_writer *parts, size_t n, FILE *fp);
+void tokbin_writer_free(tokbin_writer *w);
+// 写合并流的帧头，后面紧跟该文件的 token 流。失败返回 -1
+int tokbin_write_file_mark(FILE *fp, const char *path);
+
+//=========================
+//     读取端
+//=========================
+typedef struct {
+    tokbin_rec *recs;
+    uint32_t ntokens;
+    char *strtab;
+    uint32_t strtab_len;
+} tokbin;
+
+// 判断数据开头是否为二进制 token 流
+int tokbin_is_magic(const void *p);
+
+// 从 fp 当前位置读入整个 token 流，格式错误返回 -1
+int tokbin_read(FILE *fp, tokbin *tb);
+// 读合并流的帧头，*path 以 '\0' 结尾，由调用方 free。
+// 流正常结束返回 1，格式错误返回 -1
+int tokbin_read_file_mark(FILE *fp, char **path);
+void tokbin_free(tokbin *tb);
+
+// 第 i 个 token 的词素（以 '\0' 结尾）
+static inline const char *tokbin_text(const tokbin *tb, uint32_t i) {
+    return tb->strtab + tb->recs[i].offset;
+}
+
+#endif
@@ -0,0 +1,647 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pl0_sym.h"
+#include "tokvar.h"
+
+#define OUT_BUF_SIZE (64 * 1024)
+#define IN_BUF_SIZE  (64 * 1024)
+
+// 种别的紧凑编号：出现最多的种别在前。0 留作结束标记
+static const uint8_t code_kind[] = {
+    0,
+    SYM_IDENTIFIER, SYM_NUMBER, SYM_SEMICOLON, SYM_ASSIGN, SYM_LPAREN, SYM_RPAREN, SYM_COMMA,
+    SYM_PLUS, SYM_MINUS, SYM_TIMES, SYM_SLASH, SYM_EQU, SYM_GTR, SYM_LES, SYM_NEQ, SYM_LEQ, SYM_GEQ,
+    SYM_STRING, SYM_BEGIN, SYM_END, SYM_IF, SYM_THEN, SYM_ELSE, SYM_WHILE, SYM_DO, SYM_VAR,
+    SYM_CONST, SYM_CALL, SYM_WRITE, SYM_WRITELN, SYM_PROCEDURE,
+    SYM_FOR, SYM_PERIOD, SYM_ERROR, SYM_LBRACKET, SYM_RBRACKET, SYM_LBRACE, SYM_RBRACE,
+};
+#define NCODES (sizeof(code_kind) / sizeof(code_kind[0]))
+
+static const uint8_t kind_code[128] = {
+    [SYM_IDENTIFIER] = 1, [SYM_NUMBER] = 2, [SYM_SEMICOLON] = 3, [SYM_ASSIGN] = 4, [SYM_LPAREN] = 5,
+    [SYM_RPAREN] = 6, [SYM_COMMA] = 7, [SYM_PLUS] = 8, [SYM_MINUS] = 9, [SYM_TIMES] = 10, [SYM_SLASH] = 11,
+    [SYM_EQU] = 12, [SYM_GTR] = 13, [SYM_LES] = 14, [SYM_NEQ] = 15, [SYM_LEQ] = 16, [SYM_GEQ] = 17,
+    [SYM_STRING] = 18, [SYM_BEGIN] = 19, [SYM_END] = 20, [SYM_IF] = 21, [SYM_THEN] = 22, [SYM_ELSE] = 23,
+    [SYM_WHILE] = 24, [SYM_DO] = 25, [SYM_VAR] = 26, [SYM_CONST] = 27, [SYM_CALL] = 28, [SYM_WRITE] = 29,
+    [SYM_WRITELN] = 30, [SYM_PROCEDURE] = 31, [SYM_FOR] = 32, [SYM_PERIOD] = 33, [SYM_ERROR] = 34,
+    [SYM_LBRACKET] = 35, [SYM_RBRACKET] = 36, [SYM_LBRACE] = 37, [SYM_RBRACE] = 38,
+};
+
+// 拼写固定的种别，词素不必存
+static const char *const spelling[128] = {
+    [SYM_PLUS] = "+", [SYM_MINUS] = "-", [SYM_TIMES] = "*", [SYM_SLASH] = "/",
+    [SYM_EQU] = "=", [SYM_GTR] = ">", [SYM_LES] = "<", [SYM_NEQ] = "<>", [SYM_LEQ] = "<=", [SYM_GEQ] = ">=",
+    [SYM_LPAREN] = "(", [SYM_RPAREN] = ")", [SYM_LBRACE] = "{", [SYM_RBRACE] = "}",
+    [SYM_SEMICOLON] = ";", [SYM_COMMA] = ",", [SYM_ASSIGN] = ":=",
+    [SYM_VAR] = "var", [SYM_IF] = "if", [SYM_THEN] = "then", [SYM_ELSE] = "else", [SYM_WHILE] = "while",
+    [SYM_FOR] = "for", [SYM_BEGIN] = "begin", [SYM_WRITELN] = "writeln", [SYM_PROCEDURE] = "procedure",
+    [SYM_END] = "end", [SYM_CONST] = "const", [SYM_CALL] = "call", [SYM_DO] = "do", [SYM_WRITE] = "write",
+    [SYM_PERIOD] = ".", [SYM_LBRACKET] = "[", [SYM_RBRACKET] = "]",
+};
+
+static int grow(void **p, uint32_t *cap, uint64_t need, size_t elem) {
+    if (need <= *cap) return 0;
+    if (need > UINT32_MAX / 2) return -1;
+    uint32_t ncap = *cap ? *cap : 256;
+    while (ncap < need) ncap *= 2;
+    void *np = realloc(*p, (size_t)ncap * elem);
+    if (!np) return -1;
+    *p = np;
+    *cap = ncap;
+    return 0;
+}
+
+// v 的十进制表示写在 end 之前，返回位数
+static int format_dec(char *end, uint64_t v) {
+    int n = 0;
+    do {
+        *--end = '0' + v % 10;
+        v /= 10;
+        n++;
+    } while (v);
+    return n;
+}
+
+// 下一个 token 的预测列：字符串的词素不含两边的引号
+static inline uint32_t next_col(int kind, uint32_t col, uint32_t len) {
+    return col + (kind == SYM_STRING ? len + 2 : len);
+}
+
+// 词素的类别，各用一套长度、距离和字节的模型
+enum { LIT_IDENT, LIT_STRING, LIT_ERROR, NLIT };
+
+static inline int lit_class(int kind) {
+    return kind == SYM_IDENTIFIER ? LIT_IDENT : kind == SYM_STRING ? LIT_STRING : LIT_ERROR;
+}
+
+//=========================
+//     概率模型
+//=========================
+// 概率为 11 位定点数，表示下一位是 0 的概率；每编码一位向实际值移动 1/32
+#define PROB_BITS  11
+#define PROB_ONE   (1u << PROB_BITS)
+#define MOVE_BITS  5
+#define RANGE_TOP  (1u << 24)
+
+#define NUM_HIGH   4        // 整数最高位以下按模型编码的位数
+
+typedef struct {
+    uint16_t nbits[128];                // 有效位数 0..64，7 位的二叉树
+    uint16_t high[65][1 << NUM_HIGH];   // 最高位以下 NUM_HIGH 位，上下文为有效位数
+} num_model;
+
+struct tokvar_model {
+    uint16_t kind[64][64];              // 种别编号，上下文为上一个种别
+    uint16_t gap[64][4];                // 位置类别 g，上下文为本种别
+    uint16_t far_line;                  // 换行时行号差不为 1
+    uint16_t leading_zero;              // 数字带前导 0
+    uint16_t ref[NLIT];                 // 引用已编号的词素
+    uint16_t numbered[NLIT];            // 新词素编号
+    num_model gap_len, col, dline, value, zeros;
+    num_model dist[NLIT], len[NLIT];
+    uint16_t lit[NLIT][256][256];       // 词素字节，上下文为前一字节（词素开头为 0）
+};
+
+static tokvar_model *model_new(void) {
+    tokvar_model *m = malloc(sizeof(*m));
+    if (!m) return NULL;
+    uint16_t *p = (uint16_t *)m;
+    for (size_t i = 0; i < sizeof(*m) / sizeof(uint16_t); i++) p[i] = PROB_ONE / 2;
+    return m;
+}
+
+// 按编号存放的词素
+static int strs_init(tokvar_strs *s) {
+    memset(s, 0, sizeof(*s));
+    if (grow((void **)&s->off, &s->off_cap, 2, sizeof(uint32_t)) != 0) return -1;
+    s->off[1] = 0;
+    return 0;
+}
+
+// 追加一个词素，编号为 s->n，返回存放位置；内存不足返回 NULL
+static char *strs_add(tokvar_strs *s, uint32_t n) {
+    if (grow((void **)&s->text, &s->cap, (uint64_t)s->len + n + 1, 1) != 0 ||
+        grow((void **)&s->off, &s->off_cap, (uint64_t)s->n + 3, sizeof(uint32_t)) != 0)
+        return NULL;
+    char *dst = s->text + s->len;
+    dst[n] = '\0';
+    s->len += n + 1;
+    s->off[++s->n + 1] = s->len;
+    return dst;
+}
+
+static void strs_free(tokvar_strs *s) {
+    free(s->text);
+    free(s->off);
+    memset(s, 0, sizeof(*s));
+}
+
+//=========================
+//     写入端
+//=========================
+static unsigned char *put_varint(unsigned char *p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (unsigned char)v | 0x80;
+        v >>= 7;
+    }
+    *p++ = (unsigned char)v;
+    return p;
+}
+
+static int flush_out(tokvar_writer *w) {
+    if (w->len && !w->error && fwrite(w->buf, 1, w->len, w->fp) != w->len) w->error = 1;
+    w->len = 0;
+    return w->error ? -1 : 0;
+}
+
+static inline void out_byte(tokvar_writer *w, unsigned char b) {
+    if (w->len == OUT_BUF_SIZE) flush_out(w);
+    w->buf[w->len++] = b;
+}
+
+// 区间编码器：low 的第 32 位是进位，未定的 0xff 字节先记数，等进位确定后一起写出
+static void shift_low(tokvar_writer *w) {
+    if ((uint32_t)w->low < 0xff000000u || (w->low >> 32) != 0) {
+        unsigned char carry = w->low >> 32;
+        unsigned char b = w->cache;
+        do {
+            out_byte(w, b + carry);
+            b = 0xff;
+        } while (--w->cache_size != 0);
+        w->cache = (unsigned char)(w->low >> 24);
+    }
+    w->cache_size++;
+    w->low = (w->low & 0x00ffffffu) << 8;
+}
+
+static inline void enc_bit(tokvar_writer *w, uint16_t *p, unsigned bit) {
+    uint32_t bound = (w->range >> PROB_BITS) * *p;
+    if (!bit) {
+        w->range = bound;
+        *p += (PROB_ONE - *p) >> MOVE_BITS;
+    } else {
+        w->low += bound;
+        w->range -= bound;
+        *p -= *p >> MOVE_BITS;
+    }
+    while (w->range < RANGE_TOP) {
+        w->range <<= 8;
+        shift_low(w);
+    }
+}
+
+// 等概率的 n 位，高位在前
+static void enc_direct(tokvar_writer *w, uint64_t v, unsigned n) {
+    while (n--) {
+        w->range >>= 1;
+        if ((v >> n) & 1) w->low += w->range;
+        while (w->range < RANGE_TOP) {
+            w->range <<= 8;
+            shift_low(w);
+        }
+    }
+}
+
+// n 位的值按二叉树逐位编码，probs 有 2^n 项（0 号不用）
+static void enc_tree(tokvar_writer *w, uint16_t *probs, unsigned n, unsigned v) {
+    unsigned m = 1;
+    while (n--) {
+        unsigned bit = (v >> n) & 1;
+        enc_bit(w, &probs[m], bit);
+        m = m << 1 | bit;
+    }
+}
+
+static void enc_num(tokvar_writer *w, num_model *nm, uint64_t v) {
+    unsigned nb = v ? 64 - __builtin_clzll(v) : 0;
+    enc_tree(w, nm->nbits, 7, nb);
+    if (nb <= 1) return;
+    unsigned rest = nb - 1;             // 最高位以下的位数
+    unsigned hi = rest < NUM_HIGH ? rest : NUM_HIGH;
+    enc_tree(w, nm->high[nb], hi, (v >> (rest - hi)) & ((1u << hi) - 1));
+    enc_direct(w, v, rest - hi);
+}
+
+static uint32_t hash_text(const char *s, uint32_t n) {
+    uint32_t h = 2166136261u;
+    for (uint32_t i = 0; i < n; i++) h = (h ^ (unsigned char)s[i]) * 16777619u;
+    return h;
+}
+
+// 查错误词素的编号；没有时编入新号并置 *added。内存不足返回 0
+static uint32_t err_lookup(tokvar_writer *w, const char *text, uint32_t len, int *added) {
+    tokvar_strs *s = &w->errs;
+    // 散列表保持至多半满
+    if ((uint64_t)(s->n + 1) * 2 > w->err_hash_cap) {
+        uint32_t ncap = w->err_hash_cap ? w->err_hash_cap * 2 : 256;
+        if (ncap > UINT32_MAX / 4) return 0;
+        uint32_t *nh = calloc(ncap, sizeof(uint32_t));
+        if (!nh) return 0;
+        for (uint32_t e = 1; e <= s->n; e++) {
+            uint32_t i = hash_text(s->text + s->off[e], s->off[e + 1] - s->off[e] - 1) & (ncap - 1);
+            while (nh[i]) i = (i + 1) & (ncap - 1);
+            nh[i] = e;
+        }
+        free(w->err_hash);
+        w->err_hash = nh;
+        w->err_hash_cap = ncap;
+    }
+
+    uint32_t i = hash_text(text, len) & (w->err_hash_cap - 1);
+    for (uint32_t e; (e = w->err_hash[i]) != 0; i = (i + 1) & (w->err_hash_cap - 1))
+        if (s->off[e + 1] - s->off[e] - 1 == len && memcmp(s->text + s->off[e], text, len) == 0) return e;
+
+    char *dst = strs_add(s, len);
+    if (!dst) return 0;
+    memcpy(dst, text, len);
+    w->err_hash[i] = s->n;
+    *added = 1;
+    return s->n;
+}
+
+int tokvar_writer_init(tokvar_writer *w, FILE *fp) {
+    memset(w, 0, sizeof(*w));
+    w->fp = fp;
+    w->buf = malloc(OUT_BUF_SIZE);
+    w->m = model_new();
+    if (!w->buf || !w->m || strs_init(&w->errs) != 0) {
+        free(w->buf);
+        free(w->m);
+        strs_free(&w->errs);
+        memset(w, 0, sizeof(*w));
+        return -1;
+    }
+    memcpy(w->buf, TOKVAR_MAGIC, 4);
+    w->len = put_varint(w->buf + 4, TOKVAR_VERSION) - w->buf;
+    w->range = UINT32_MAX;
+    w->cache_size = 1;
+    return 0;
+}
+
+int tokvar_put(tokvar_writer *w, int kind, const char *text, uint32_t len, pl0_loc loc, uint32_t id,
+               int64_t value) {
+    if (w->error) return -1;
+    unsigned code = (unsigned)kind < 128 ? kind_code[kind] : 0;
+
+    // 先检查能否编码，不写出半条记录
+    const char *fixed = (unsigned)kind < 128 ? spelling[kind] : NULL;
+    uint32_t zeros = 0;
+    if (!code || (fixed && (strlen(fixed) != len || memcmp(fixed, text, len) != 0))) {
+        w->error = 1;
+        return -1;
+    }
+    if (kind == SYM_NUMBER) {
+        // 词素必须是若干个 0 加上 value 的十进制表示
+        char digits[24];
+        int nd = value < 0 ? 0 : format_dec(digits + sizeof(digits), value);
+        zeros = len - nd;
+        if (nd == 0 || len < (uint32_t)nd || memcmp(text + zeros, digits + sizeof(digits) - nd, nd) != 0) {
+            w->error = 1;
+            return -1;
+        }
+        for (uint32_t i = 0; i < zeros; i++) {
+            if (text[i] != '0') {
+                w->error = 1;
+                return -1;
+            }
+        }
+    }
+    // ref：0 不编号，1 编入新号，r >= 2 引用编号 r - 1
+    uint64_t ref = 0;
+    uint32_t nref = 0;          // 引用时同类已编号的个数
+    if (kind == SYM_ERROR) {
+        int added = 0;
+        uint32_t e = err_lookup(w, text, len, &added);
+        if (!e) {
+            w->error = 1;
+            return -1;
+        }
+        ref = added ? 1 : (uint64_t)e + 1;
+        nref = w->errs.n;
+    } else if (!fixed && kind != SYM_NUMBER && id) {
+        uint32_t old = w->sym_cap;
+        if (grow((void **)&w->sym_map, &w->sym_cap, (uint64_t)id + 1, sizeof(uint32_t)) != 0) {
+            w->error = 1;
+            return -1;
+        }
+        memset(w->sym_map + old, 0, (size_t)(w->sym_cap - old) * sizeof(uint32_t));
+        if (w->sym_map[id]) {
+            ref = (uint64_t)w->sym_map[id] + 1;
+        } else {
+            w->sym_map[id] = ++w->nsyms;
+            ref = 1;
+        }
+        nref = w->nsyms;
+    }
+
+    tokvar_model *m = w->m;
+    enc_tree(w, m->kind[w->prev_code], 6, code);
+    w->prev_code = code;
+
+    // 位置
+    uint32_t line = PL0_LINE(loc), col = PL0_COL(loc);
+    unsigned g = 3;
+    uint32_t d = 0;
+    if (line == w->line && col >= w->next_col) {
+        d = col - w->next_col;
+        g = d < 2 ? d : 2;
+    }
+    enc_tree(w, m->gap[code], 2, g);
+    if (g == 2) {
+        enc_num(w, &m->gap_len, d - 2);
+    } else if (g == 3) {
+        // 绝大多数是换到下一行，行号差为 1 时不单独存
+        int64_t dl = (int64_t)line - w->line;
+        enc_bit(w, &m->far_line, dl != 1);
+        enc_num(w, &m->col, col);
+        if (dl != 1) enc_num(w, &m->dline, ((uint64_t)dl << 1) ^ (uint64_t)(dl >> 63));
+    }
+    w->line = line;
+    w->next_col = next_col(kind, col, len);
+
+    // 词素
+    if (kind == SYM_NUMBER) {
+        enc_bit(w, &m->leading_zero, zeros > 0);
+        enc_num(w, &m->value, (uint64_t)value);
+        if (zeros) enc_num(w, &m->zeros, zeros);
+    } else if (!fixed) {
+        int lc = lit_class(kind);
+        enc_bit(w, &m->ref[lc], ref >= 2);
+        if (ref >= 2) {
+            enc_num(w, &m->dist[lc], nref - (ref - 1));
+        } else {
+            enc_bit(w, &m->numbered[lc], ref == 1);
+            enc_num(w, &m->len[lc], len);
+            unsigned prev = 0;
+            for (uint32_t i = 0; i < len; i++) {
+                unsigned char c = text[i];
+                enc_tree(w, m->lit[lc][prev], 8, c);
+                prev = c;
+            }
+        }
+    }
+    w->ntokens++;
+    return w->error ? -1 : 0;
+}
+
+int tokvar_writer_close(tokvar_writer *w) {
+    if (w->buf) {
+        enc_tree(w, w->m->kind[w->prev_code], 6, 0);   // 结束标记
+        for (int i = 0; i < 5; i++) shift_low(w);
+        flush_out(w);
+    }
+    if (!w->error && fflush(w->fp) != 0) w->error = 1;
+    int err = w->error;
+    free(w->buf);
+    free(w->m);
+    free(w->sym_map);
+    free(w->err_hash);
+    strs_free(&w->errs);
+    memset(w, 0, sizeof(*w));
+    return err ? -1 : 0;
+}
+
+//=========================
+//     读取端
+//=========================
+int tokvar_is_magic(const void *p) {
+    return memcmp(p, TOKVAR_MAGIC, 4) == 0;
+}
+
+// 使缓冲区中至少有 n 字节未解码的数据（输入结束时可能不足）
+static void fill(tokvar_reader *r, size_t n) {
+    if (r->len - r->pos >= n || r->eof) return;
+    size_t rest = r->len - r->pos;
+    memmove(r->buf, r->buf + r->pos, rest);
+    r->pos = 0;
+    r->len = rest;
+    size_t want = r->cap - r->len;
+    size_t got = fread(r->buf + r->len, 1, want, r->fp);
+    r->len += got;
+    if (got < want) r->eof = 1;
+}
+
+static inline unsigned in_byte(tokvar_reader *r) {
+    if (r->pos == r->len) {
+        fill(r, 1);
+        if (r->pos == r->len) {
+            r->overrun = 1;
+            return 0;
+        }
+    }
+    return r->buf[r->pos++];
+}
+
+static inline int get_varint(tokvar_reader *r, uint64_t *v) {
+    uint64_t x = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (r->pos == r->len) return -1;
+        unsigned b = r->buf[r->pos++];
+        x |= (uint64_t)(b & 0x7f) << shift;
+        if (b < 0x80) {
+            *v = x;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static inline unsigned dec_bit(tokvar_reader *r, uint16_t *p) {
+    uint32_t bound = (r->range >> PROB_BITS) * *p;
+    unsigned bit;
+    if (r->code < bound) {
+        r->range = bound;
+        *p += (PROB_ONE - *p) >> MOVE_BITS;
+        bit = 0;
+    } else {
+        r->code -= bound;
+        r->range -= bound;
+        *p -= *p >> MOVE_BITS;
+        bit = 1;
+    }
+    while (r->range < RANGE_TOP) {
+        r->range <<= 8;
+        r->code = r->code << 8 | in_byte(r);
+    }
+    return bit;
+}
+
+static uint64_t dec_direct(tokvar_reader *r, unsigned n) {
+    uint64_t v = 0;
+    while (n--) {
+        r->range >>= 1;
+        unsigned bit = r->code >= r->range;
+        if (bit) r->code -= r->range;
+        v = v << 1 | bit;
+        while (r->range < RANGE_TOP) {
+            r->range <<= 8;
+            r->code = r->code << 8 | in_byte(r);
+        }
+    }
+    return v;
+}
+
+static unsigned dec_tree(tokvar_reader *r, uint16_t *probs, unsigned n) {
+    unsigned m = 1;
+    for (unsigned i = 0; i < n; i++) m = m << 1 | dec_bit(r, &probs[m]);
+    return m - (1u << n);
+}
+
+// 有效位数超过 64 返回 -1
+static int dec_num(tokvar_reader *r, num_model *nm, uint64_t *v) {
+    unsigned nb = dec_tree(r, nm->nbits, 7);
+    if (nb > 64) return -1;
+    if (nb <= 1) {
+        *v = nb;
+        return 0;
+    }
+    unsigned rest = nb - 1;
+    unsigned hi = rest < NUM_HIGH ? rest : NUM_HIGH;
+    uint64_t x = 1u << hi | dec_tree(r, nm->high[nb], hi);
+    *v = x << (rest - hi) | dec_direct(r, rest - hi);
+    return 0;
+}
+
+int tokvar_open(tokvar_reader *r, FILE *fp) {
+    memset(r, 0, sizeof(*r));
+    r->fp = fp;
+    r->cap = IN_BUF_SIZE;
+    r->buf = malloc(r->cap);
+    r->m = model_new();
+    if (!r->buf || !r->m || strs_init(&r->syms) != 0 || strs_init(&r->errs) != 0) goto fail;
+
+    fill(r, 8);
+    uint64_t version;
+    if (r->len < 4 || !tokvar_is_magic(r->buf)) goto fail;
+    r->pos = 4;
+    if (get_varint(r, &version) != 0 || version != TOKVAR_VERSION) goto fail;
+
+    // 编码器写出的第一个字节总是 0
+    r->range = UINT32_MAX;
+    if (in_byte(r) != 0) goto fail;
+    for (int i = 0; i < 4; i++) r->code = r->code << 8 | in_byte(r);
+    if (r->overrun) goto fail;
+    return 0;
+
+fail:
+    tokvar_close(r);
+    return -1;
+}
+
+int tokvar_next(tokvar_reader *r, tokvar_token *t) {
+    if (r->done) return 0;
+    tokvar_model *m = r->m;
+
+    unsigned code = dec_tree(r, m->kind[r->prev_code], 6);
+    if (r->overrun || code >= NCODES) return -1;
+    if (code == 0) {
+        r->done = 1;
+        return 0;
+    }
+    r->prev_code = code;
+    int kind = code_kind[code];
+
+    // 位置
+    uint32_t line = r->line, col = r->next_col;
+    uint64_t v;
+    switch (dec_tree(r, m->gap[code], 2)) {
+        case 2:
+            if (dec_num(r, &m->gap_len, &v) != 0) return -1;
+            col += 2 + (uint32_t)v;
+            break;
+        case 3: {
+            unsigned far = dec_bit(r, &m->far_line);
+            if (dec_num(r, &m->col, &v) != 0) return -1;
+            col = (uint32_t)v;
+            if (!far) {
+                line++;
+            } else {
+                if (dec_num(r, &m->dline, &v) != 0) return -1;
+                line += (uint32_t)((v >> 1) ^ (0 - (v & 1)));
+            }
+            break;
+        }
+        case 1:
+            col++;
+            break;
+    }
+    t->kind = kind;
+    t->id = 0;
+    t->loc = PL0_LOC(line, col);
+    t->value = 0;
+
+    // 词素
+    if (spelling[kind]) {
+        t->text = spelling[kind];
+        t->len = strlen(t->text);
+    } else if (kind == SYM_NUMBER) {
+        uint64_t zeros = 0;
+        unsigned has_zeros = dec_bit(r, &m->leading_zero);
+        if (dec_num(r, &m->value, &v) != 0 || (has_zeros && dec_num(r, &m->zeros, &zeros) != 0)) return -1;
+        if (zeros > UINT32_MAX - 32 || r->overrun) return -1;
+        if (grow((void **)&r->lit, &r->lit_cap, zeros + 24, 1) != 0) return -1;
+        t->value = (int64_t)v;
+        memset(r->lit, '0', zeros);
+        char digits[24];
+        int nd = format_dec(digits + sizeof(digits), v);
+        memcpy(r->lit + zeros, digits + sizeof(digits) - nd, nd);
+        t->len = zeros + nd;
+        r->lit[t->len] = '\0';
+        t->text = r->lit;
+    } else {
+        int lc = lit_class(kind);
+        tokvar_strs *s = lc == LIT_ERROR ? &r->errs : &r->syms;
+        if (dec_bit(r, &m->ref[lc])) {
+            if (dec_num(r, &m->dist[lc], &v) != 0 || v >= s->n) return -1;
+            uint32_t e = s->n - (uint32_t)v;
+            t->text = s->text + s->off[e];
+            t->len = s->off[e + 1] - s->off[e] - 1;
+            if (lc != LIT_ERROR) t->id = e;
+        } else {
+            unsigned numbered = dec_bit(r, &m->numbered[lc]);
+            uint64_t n;
+            if (dec_num(r, &m->len[lc], &n) != 0 || n > UINT32_MAX / 4 || r->overrun) return -1;
+            // 长度来自输入，按实际解码出的字节逐步扩大缓冲，损坏的流不会先分配巨大的内存
+            char *dst = NULL;
+            uint32_t cap = 0;
+            for (uint32_t i = 0; i <= n; i++) {
+                if (i == cap) {
+                    uint32_t ncap = n - i < 4096 ? n + 1 : i + 4096;
+                    if (numbered ? grow((void **)&s->text, &s->cap, (uint64_t)s->len + ncap, 1) != 0
+                                 : grow((void **)&r->lit, &r->lit_cap, ncap, 1) != 0)
+                        return -1;
+                    dst = numbered ? s->text + s->len : r->lit;
+                    cap = ncap;
+                }
+                if (i == n) break;
+                unsigned prev = i ? (unsigned char)dst[i - 1] : 0;
+                dst[i] = (char)dec_tree(r, m->lit[lc][prev], 8);
+                if (r->overrun) return -1;
+            }
+            if (numbered) {
+                dst = strs_add(s, n);   // 词素已解码到 s->text + s->len，这里只登记
+                if (!dst) return -1;
+                if (lc != LIT_ERROR) t->id = s->n;
+            } else {
+                dst[n] = '\0';
+            }
+            t->text = dst;
+            t->len = n;
+        }
+    }
+    if (r->overrun) return -1;
+
+    r->line = line;
+    r->next_col = next_col(kind, col, t->len);
+    return 1;
+}
+
+void tokvar_close(tokvar_reader *r) {
+    free(r->buf);
+    free(r->m);
+    strs_free(&r->syms);
+    strs_free(&r->errs);
+    free(r->lit);
+    memset(r, 0, sizeof(*r));
+}
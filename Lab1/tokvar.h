@@ -0,0 +1,120 @@
+#ifndef TOKVAR_H
+#define TOKVAR_H
+
+// 压缩 token 流格式（lexer_manual -z 输出），用于存档大批语料的 token；Lab2 / Lab3 可直接读取
+//
+//     char magic[4]                 TOKVAR_MAGIC
+//     varint version                TOKVAR_VERSION（LEB128）
+//     记录 ...                      每个 token 一条，区间编码，逐条顺序解码
+//     种别编号 0                    结束标记
+//
+// 记录的各个字段用自适应二进制区间编码（与 LZMA 相同的编码器）写出，每个字段有自己的概率模型：
+//
+//     种别                          紧凑编号（常见种别在前），上下文为上一个 token 的种别
+//     位置类别 g                    与上一个 token 的预测位置比较：预测列 = 上一个 token 的列 + 源码长度，
+//                                   上下文为本 token 的种别
+//         g = 0 / 1                 同一行，列 = 预测列 + g
+//         g = 2                     同一行，整数 d，列 = 预测列 + 2 + d
+//         g = 3                     换行：一位表示行号差不为 1，整数列号，行号差不为 1 时再跟整数行号差（zigzag）
+//     词素                          按种别不同：
+//         拼写固定的 token          无，由种别得出
+//         数字                      一位表示有前导 0，整数值，有前导 0 时再跟整数个数
+//         标识符 / 字符串 / 错误    一位表示引用已编号的词素，是则跟整数距离（最近编号的为 0）；
+//                                   否则一位表示是否编号，再跟整数长度和各字节（上下文为前一字节）
+//
+// 整数先写有效位数，再写最高位以下至多 4 位（上下文为位数），其余低位按等概率写出。
+// 标识符 / 字符串在流内按调用方符号 ID 首次出现的顺序从 1 编号，相同的标识符 / 字符串 ID 相同；
+// 错误词素（如 "=== Unclosed comment ==="）由写入端按内容去重，单独编号，读出时 ID 为 0。
+// 魔数以 0xff 开头，不是合法的 UTF-8 字节，与文本格式和 tokbin（0x7f）都不会混淆。
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "pl0_loc.h"
+
+#define TOKVAR_MAGIC   "\xffP0V"
+#define TOKVAR_VERSION 2
+
+// 按编号存放的词素：编号 i（从 1 起）的词素为 text + off[i]，以 '\0' 结尾，off[n + 1] 总是 len
+typedef struct {
+    char *text;
+    uint32_t len, cap;
+    uint32_t *off;
+    uint32_t n, off_cap;
+} tokvar_strs;
+
+typedef struct tokvar_model tokvar_model;   // 各字段的概率模型，见 tokvar.c
+
+//=========================
+//     写入端
+//=========================
+typedef struct {
+    FILE *fp;
+    unsigned char *buf;         // 输出缓冲，满了再 fwrite
+    size_t len;
+    tokvar_model *m;
+    uint64_t low;               // 区间编码器状态
+    uint32_t range;
+    unsigned char cache;
+    uint64_t cache_size;
+    uint32_t *sym_map;          // sym_map[调用方 ID]：流内符号 ID，0 表示尚未出现
+    uint32_t sym_cap;
+    uint32_t nsyms;             // 流内已编号的符号数
+    tokvar_strs errs;           // 已编号的错误词素
+    uint32_t *err_hash;         // 错误词素的开放寻址散列表，存编号，0 表示空
+    uint32_t err_hash_cap;
+    uint32_t line, next_col;    // 上一个 token 的行与预测列
+    unsigned prev_code;         // 上一个 token 的种别编号
+    int error;                  // 写出失败或 token 无法编码后置 1
+    unsigned long long ntokens;
+} tokvar_writer;
+
+// 写出文件头，失败返回 -1
+int tokvar_writer_init(tokvar_writer *w, FILE *fp);
+// 追加一个 token。id 为调用方的符号 ID（没有则传 0），只要求相同的词素 ID 相同；
+// value 为数字的值，数字的词素必须是 value 的十进制表示（可带前导 0）。失败返回 -1
+int tokvar_put(tokvar_writer *w, int kind, const char *text, uint32_t len, pl0_loc loc, uint32_t id,
+               int64_t value);
+// 写出结束标记与缓冲区中的内容并释放，失败返回 -1
+int tokvar_writer_close(tokvar_writer *w);
+
+//=========================
+//     读取端
+//=========================
+// 流式解码：只缓冲一小块输入和符号表，内存与 token 数无关
+typedef struct {
+    int kind;
+    uint32_t id;                // 符号 ID，0 表示无
+    pl0_loc loc;
+    int64_t value;              // 数字的值，其他 token 为 0
+    const char *text;           // 词素，以 '\0' 结尾，下次调用 tokvar_next 前有效
+    uint32_t len;
+} tokvar_token;
+
+typedef struct {
+    FILE *fp;
+    unsigned char *buf;         // 输入缓冲，[pos, len) 尚未解码
+    size_t pos, len, cap;
+    int eof;
+    int overrun;                // 解码读过了输入末尾，说明流已损坏
+    tokvar_model *m;
+    uint32_t range, code;       // 区间解码器状态
+    tokvar_strs syms;           // 标识符 / 字符串
+    tokvar_strs errs;           // 错误词素
+    char *lit;                  // 不编号的词素、数字的文本
+    uint32_t lit_cap;
+    uint32_t line, next_col;
+    unsigned prev_code;
+    int done;
+} tokvar_reader;
+
+// 判断数据开头是否为压缩 token 流
+int tokvar_is_magic(const void *p);
+
+// 读文件头，格式错误返回 -1
+int tokvar_open(tokvar_reader *r, FILE *fp);
+// 解码下一个 token：成功返回 1，流结束返回 0，格式错误返回 -1
+int tokvar_next(tokvar_reader *r, tokvar_token *t);
+void tokvar_close(tokvar_reader *r);
+
+#endif
@@ -0,0 +1,164 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "pl0_sym.h"
+#include "tokwriter.h"
+
+// 一个 token 除词素外最多占用的字节数："(" + 整数 + ", \"" + "\")\n"
+#define TW_OVERHEAD 32
+
+int tw_init(tokwriter *w, int fd) {
+    memset(w, 0, sizeof(*w));
+    w->fd = fd;
+    w->cap = TW_BUF_SIZE;
+    w->buf = malloc(w->cap);
+    return w->buf ? 0 : -1;
+}
+
+int tw_init_mem(tokwriter *w, size_t cap) {
+    memset(w, 0, sizeof(*w));
+    w->fd = -1;
+    w->cap = cap < TW_OVERHEAD ? TW_OVERHEAD : cap;
+    w->buf = malloc(w->cap);
+    return w->buf ? 0 : -1;
+}
+
+static int write_all(int fd, const char *p, size_t n) {
+    while (n > 0) {
+        ssize_t k = write(fd, p, n);
+        if (k < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += k;
+        n -= k;
+    }
+    return 0;
+}
+
+int tw_write_to(tokwriter *w, int fd) {
+    if (!w->error && w->len && write_all(fd, w->buf, w->len) != 0)
+        w->error = 1;
+    w->len = 0;
+    return w->error ? -1 : 0;
+}
+
+int tw_flush(tokwriter *w) {
+    if (w->fd < 0) return w->error ? -1 : 0;
+    if (!w->error && w->len && write_all(w->fd, w->buf, w->len) != 0)
+        w->error = 1;
+    w->len = 0;
+    return w->error ? -1 : 0;
+}
+
+int tw_close(tokwriter *w) {
+    int ret = tw_flush(w);
+    free(w->buf);
+    w->buf = NULL;
+    return ret;
+}
+
+// 手写的无符号整数格式化，返回写入的字节数
+static inline size_t put_uint(char *p, unsigned v) {
+    char tmp[10];
+    size_t n = 0;
+    do {
+        tmp[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    for (size_t i = 0; i < n; i++) p[i] = tmp[n - 1 - i];
+    return n;
+}
+
+// 写出 token 头部 "(sym, \"" 或 "(2, "，返回写入的字节数
+static inline size_t put_head(char *p, int sym) {
+    size_t n = 0;
+    p[n++] = '(';
+    n += put_uint(p + n, (unsigned)sym);
+    p[n++] = ',';
+    p[n++] = ' ';
+    if (sym != SYM_NUMBER) p[n++] = '"';
+    return n;
+}
+
+static inline size_t put_tail(char *p, int sym) {
+    size_t n = 0;
+    if (sym != SYM_NUMBER) p[n++] = '"';
+    p[n++] = ')';
+    p[n++] = '\n';
+    return n;
+}
+
+// 内存输出：把缓冲区扩大到至少 need 字节
+static int grow_buf(tokwriter *w, size_t need) {
+    size_t cap = w->cap * 2;
+    if (cap < need) cap = need;
+    char *p = w->error ? NULL : realloc(w->buf, cap);
+    if (!p) {
+        w->error = 1;
+        return -1;
+    }
+    w->buf = p;
+    w->cap = cap;
+    return 0;
+}
+
+// 词素本身比缓冲区还大：缓冲区、词素、结尾三段一次 writev，省去拷贝
+static void write_large(tokwriter *w, int sym, const char *text, size_t len) {
+    char tail[4];
+    size_t hn = put_head(w->buf, sym);
+    size_t tn = put_tail(tail, sym);
+    struct iovec iov[3] = {
+        { w->buf, hn },
+        { (void *)text, len },
+        { tail, tn },
+    };
+    size_t total = hn + len + tn;
+    ssize_t k = -1;
+    if (!w->error) {
+        do {
+            k = writev(w->fd, iov, 3);
+        } while (k < 0 && errno == EINTR);
+    }
+    if (k >= 0 && (size_t)k < total) {
+        // 部分写出：剩余部分逐段补齐
+        size_t done = k;
+        for (int i = 0; i < 3 && !w->error; i++) {
+            if (done >= iov[i].iov_len) {
+                done -= iov[i].iov_len;
+                continue;
+            }
+            if (write_all(w->fd, (char *)iov[i].iov_base + done, iov[i].iov_len - done) != 0)
+                w->error = 1;
+            done = 0;
+        }
+    } else if (k < 0) {
+        w->error = 1;
+    }
+}
+
+void tw_token(tokwriter *w, int sym, const char *text, size_t len) {
+    w->ntokens++;
+
+    if (w->len + len + TW_OVERHEAD > w->cap) {
+        if (w->fd < 0) {
+            if (grow_buf(w, w->len + len + TW_OVERHEAD) != 0) return;
+        } else {
+            tw_flush(w);
+            if (len + TW_OVERHEAD > w->cap) {
+                write_large(w, sym, text, len);
+                return;
+            }
+        }
+    }
+
+    char *p = w->buf + w->len;
+    size_t n = put_head(p, sym);
+    memcpy(p + n, text, len);
+    n += len;
+    n += put_tail(p + n, sym);
+    w->len += n;
+}
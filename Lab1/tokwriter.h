@@ -0,0 +1,43 @@
+#ifndef TOKWRITER_H
+#define TOKWRITER_H
+
+// 文本 token 输出：格式与原来的 printf 完全一致
+//
+//     (2, 123)            数字
+//     (sym, "text")       其他
+//
+// 先格式化到一大块用户态缓冲区，满了再用 write / writev 一次写出，
+// 不走 stdio，也不解析格式串。lexer_manual.c 与 pl0_lexer.l 共用。
+//
+// tw_init_mem 得到内存输出：缓冲区只增不写，之后由 tw_write_to 一次写出，
+// 供并行分析时各块先各自格式化、再按顺序输出。
+
+#include <stddef.h>
+
+#define TW_BUF_SIZE (256 * 1024)
+
+typedef struct {
+    int fd;                     // 输出描述符，-1 表示内存输出
+    char *buf;
+    size_t len;                 // 缓冲区中待写出的字节数
+    size_t cap;                 // 缓冲区大小
+    int error;                  // 写出失败后置 1，之后的输出全部丢弃
+    unsigned long long ntokens; // 已输出的 token 数
+} tokwriter;
+
+// 失败返回 -1
+int tw_init(tokwriter *w, int fd);
+// 内存输出，cap 为初始容量
+int tw_init_mem(tokwriter *w, size_t cap);
+// 把缓冲区中的内容写到 fd 并清空，失败返回 -1
+int tw_write_to(tokwriter *w, int fd);
+void tw_token(tokwriter *w, int sym, const char *text, size_t len);
+// 写出缓冲区中的全部内容（内存输出不做任何事），失败返回 -1
+int tw_flush(tokwriter *w);
+// 写出剩余内容并释放缓冲区，失败返回 -1
+int tw_close(tokwriter *w);
+
+// 输出字面量词素，如 TW_LIT(w, SYM_ERROR, "=== Unclosed comment ===")
+#define TW_LIT(w, sym, lit) tw_token((w), (sym), (lit), sizeof(lit) - 1)
+
+#endif
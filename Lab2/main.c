@@ -3,6 +3,14 @@
 #include <ctype.h>
 #include <string.h>
 
+// 二进制 / 压缩 token 流读取，以及直接调用词法分析器分析源程序，编译:
+//     gcc -O2 -pthread main.c ../Lab1/tokbin.c ../Lab1/tokvar.c ../Lab1/pl0lex.c ../Lab1/pl0look.c ../Lab1/lex_simd.c ../Lab1/intern.c -o main
+#include "../Lab1/tokbin.h"
+#include "../Lab1/tokvar.h"
+#define PL0LEX_NO_SYM       // 种别码用下面自己的定义
+#include "../Lab1/pl0lex.h"
+#include "../Lab1/pl0look.h"
+
 // --- 1. 测试文本信息 ---
 /*
     test_corr.txt   // 正确文法信息
@@ -11,20 +19,54 @@
     test_err3.txt   // 错误文法信息 -- 缺少运算量2
     test_err4.txt   // 错误文法信息 -- 缺少运算符
     test_err5.txt   // 错误文法信息 -- 多个错误检查
+
+    文件读取时也可直接给出 lexer_manual -b 输出的二进制 token 流或 -z 输出的压缩 token 流；
+    源程序分析时直接调用词法分析器，不经过二元序列文本
 */
 
 // --- 2. 定义变量 ---
-#define MAX_BUF 2048        // 最大输入长度
+#define MAX_BUF 2048        // 一句显示文本的最大长度
 
 // 全局变量
-char buffer[MAX_BUF];       // 存储当前行的输入
-int pos = 0;                // 当前字符位置
+char buffer[MAX_BUF];       // 当前语句的二元序列文本，仅用于显示，超长截断
 int current_code = 0;       // 当前Token的数值编号
 char sym;                   // 映射到简易文法的字符 (+, *, (, ), i, ;, #)
 char lexeme[100];           // Token的文本值
 int error_pos = -1;         // 错误位置
 char error_sym = 0;         // 错误符号
-
+unsigned error_line = 0;    // 错误 token 在源程序中的行、列（仅二进制输入），0 表示未知
+unsigned error_col = 0;
+
+// 当前语句拆成的 token 序列，advance() 依次取用；按需增长，不限长度
+typedef struct {
+    int code;               // 种别码
+    unsigned id;            // 符号 ID（仅二进制输入），0 表示无
+    unsigned line, col;     // 源程序中的行、列（仅二进制输入），0 表示未知
+    char sym;               // 映射到的文法字符
+    char lexeme[100];       // 文本值
+    int start;              // 在 buffer 中的起始位置（用于标出错误位置）
+    int quiet;              // 1: 不成形的片段，不打印也不更新错误位置
+} StmtToken;
+
+StmtToken *stmt = NULL;
+int stmt_cap = 0;           // stmt 的容量
+int stmt_len = 0;           // 当前语句的 token 数
+int stmt_pos = 0;           // 下一个待取的 token
+
+// 本句下一个 token 的位置（stmt[stmt_len]），容量不够时加倍
+StmtToken *stmt_slot() {
+    if (stmt_len == stmt_cap) {
+        int cap = stmt_cap ? stmt_cap * 2 : 256;
+        StmtToken *p = realloc(stmt, cap * sizeof(StmtToken));
+        if (!p) {
+            printf("内存不足。\n");
+            exit(1);
+        }
+        stmt = p;
+        stmt_cap = cap;
+    }
+    return &stmt[stmt_len];
+}
 
 // --- 3. 定义 Token 类型 ---
 enum {
@@ -48,97 +90,165 @@ int T_prime();
 int F();
 void error(const char *msg);
 
-// 词法分析器
-void advance() {
-    int token_start = pos;   // 记录本 token 开始位置
-    current_code = 0;
-    lexeme[0] = '\0';
-
-    while (buffer[pos] != '\0' &&
-           (isspace(buffer[pos]) || buffer[pos] == ',')) {
-        pos++;
+// Token -> 文法字符映射
+char map_sym(int code) {
+    switch (code) {
+        case SYM_IDENTIFIER:
+        case SYM_NUMBER:
+            return 'i';
+        case SYM_PLUS:
+            return '+';
+        case SYM_TIMES:
+            return '*';
+        case SYM_LPAREN:
+            return '(';
+        case SYM_RPAREN:
+            return ')';
+        case SYM_SEMICOLON:
+            return ';';
+        default:
+            return '?';
     }
+}
 
-    if (buffer[pos] == '\0') {
-        sym = '#';
-        current_code = SYM_NULL;
-        strcpy(lexeme, "EOF");
+// 二元序列文本的输入：逐字符读取，不按行缓冲，行再长也不会截断。
+// 换行读作空格（与原来逐行拼接时相同）；终端输入时单独一行 END 即输入结束
+typedef struct {
+    FILE *fp;
+    int stop_at_end;        // 1: 识别 END 行
+    int ch;                 // 当前字符，EOF 表示输入结束
+    int bol;                // 下一个字符位于行首
+    int done;
+    char ahead[4];          // 行首判断 END 时多读的字符，依次取用
+    int nahead, ahead_pos;
+} TextIn;
+
+// 读入下一个字符到 in->ch
+void text_next(TextIn *in) {
+    if (in->done) {
+        in->ch = EOF;
         return;
     }
+    if (in->stop_at_end && in->bol && in->ahead_pos >= in->nahead) {
+        // 先读出至多 4 个字符看是否为 "END\n"（或 "END" 后输入结束），不是再依次交出
+        int n = 0, c = 0;
+        while (n < 4 && (c = getc(in->fp)) != EOF) {
+            in->ahead[n++] = (char)c;
+            if (c == '\n') break;
+        }
+        if ((n == 4 && memcmp(in->ahead, "END\n", 4) == 0) ||
+            (n == 3 && c == EOF && memcmp(in->ahead, "END", 3) == 0)) {
+            in->done = 1;
+            in->ch = EOF;
+            return;
+        }
+        in->nahead = n;
+        in->ahead_pos = 0;
+    }
 
-    if (buffer[pos] != '(') {
-        sym = '?';
-        lexeme[0] = buffer[pos];
-        lexeme[1] = '\0';
-        pos++;
-        return;
+    int c = in->ahead_pos < in->nahead ? (unsigned char)in->ahead[in->ahead_pos++] : getc(in->fp);
+    if (c == EOF) {
+        if (!in->bol) c = '\n';    // 最后一行没有换行时按有换行处理，末尾同样读作一个空格
+        else in->done = 1;
+    }
+    in->bol = c == '\n';
+    in->ch = c == '\n' ? ' ' : c;
+}
+
+// 当前字符计入本句的显示文本（超出 buffer 的部分不显示），再读下一个
+void text_take(TextIn *in, int *len) {
+    if (*len < MAX_BUF - 1) {
+        buffer[(*len)++] = (char)in->ch;
+        buffer[*len] = '\0';
+    }
+    text_next(in);
+}
+
+// 从输入中拆出下一个 token 存入 t，输入结束返回 0。
+// 规则与原来先拼接整段文本再拆分时相同：不成形的片段记为不打印的 '?'
+int scan_text_token(TextIn *in, int *len, StmtToken *t) {
+    t->start = *len;        // 记录本 token 开始位置
+    t->code = 0;
+    t->id = 0;
+    t->line = t->col = 0;
+    t->lexeme[0] = '\0';
+    t->quiet = 1;
+
+    while (in->ch != EOF && (isspace(in->ch) || in->ch == ',')) text_take(in, len);
+    if (in->ch == EOF) return 0;
+
+    if (in->ch != '(') {
+        t->sym = '?';
+        t->lexeme[0] = (char)in->ch;
+        t->lexeme[1] = '\0';
+        text_take(in, len);
+        return 1;
     }
 
-    pos++;  // 吃掉 '('
+    text_take(in, len);     // 吃掉 '('
 
     // --- A. 读取整数 code ---
-    while (isspace(buffer[pos])) pos++;
+    while (in->ch != EOF && isspace(in->ch)) text_take(in, len);
 
     char num_buf[32];
     int k = 0;
 
-    if (!isdigit(buffer[pos])) {
-        sym = '?';
-        return;
+    if (in->ch == EOF || !isdigit(in->ch)) {
+        t->sym = '?';
+        return 1;
     }
 
-    while (isdigit(buffer[pos])) {
-        num_buf[k++] = buffer[pos++];
+    while (in->ch != EOF && isdigit(in->ch)) {
+        if (k < 31) num_buf[k++] = (char)in->ch;
+        text_take(in, len);
     }
     num_buf[k] = '\0';
-    current_code = atoi(num_buf);
+    t->code = atoi(num_buf);
 
-    // --- B. 寻找左引号 ---
-    while (buffer[pos] != '\0' && buffer[pos] != '"') pos++;
-    if (buffer[pos] == '"') pos++;
+    // --- B. 跳过逗号和空白 ---
+    while (in->ch != EOF && (isspace(in->ch) || in->ch == ',')) text_take(in, len);
 
-    // --- C. 读取 value ---
+    // --- C. 读取 value：带引号的读到右引号；
+    //        lexer_manual 输出的数字不带引号，如 (2, 10)，读到 ')' 为止 ---
+    int quoted = in->ch == '"';
+    if (quoted) text_take(in, len);
     k = 0;
-    while (buffer[pos] != '\0' && buffer[pos] != '"') {
-        if (k < 99) lexeme[k++] = buffer[pos];
-        pos++;
+    while (in->ch != EOF && in->ch != (quoted ? '"' : ')')) {
+        if (k < 99) t->lexeme[k++] = (char)in->ch;
+        text_take(in, len);
     }
-    lexeme[k] = '\0';
+    t->lexeme[k] = '\0';
 
-    if (buffer[pos] == '"') pos++;
+    if (quoted && in->ch == '"') text_take(in, len);
 
     // --- D. 跳到 ')' ---
-    while (buffer[pos] != '\0' && buffer[pos] != ')') pos++;
-    if (buffer[pos] == ')') pos++;
+    while (in->ch != EOF && in->ch != ')') text_take(in, len);
+    if (in->ch == ')') text_take(in, len);
 
-    // Token -> 文法字符映射
-    switch (current_code) {
-        case SYM_IDENTIFIER:
-        case SYM_NUMBER:
-            sym = 'i';
-            break;
-        case SYM_PLUS:
-            sym = '+';
-            break;
-        case SYM_TIMES:
-            sym = '*';
-            break;
-        case SYM_LPAREN:
-            sym = '(';
-            break;
-        case SYM_RPAREN:
-            sym = ')';
-            break;
-        case SYM_SEMICOLON:
-            sym = ';';
-            break;
-        default:
-            sym = '?';
-            break;
+    t->sym = map_sym(t->code);
+    t->quiet = 0;
+    return 1;
+}
+
+// 词法分析器：从当前语句的 token 序列中取下一个
+void advance() {
+    if (stmt_pos >= stmt_len) {
+        sym = '#';
+        current_code = SYM_NULL;
+        strcpy(lexeme, "EOF");
+        return;
     }
 
-    error_pos = token_start;
+    StmtToken *t = &stmt[stmt_pos++];
+    current_code = t->code;
+    sym = t->sym;
+    strcpy(lexeme, t->lexeme);
+    if (t->quiet) return;
+
+    error_pos = t->start;
     error_sym = sym;
+    error_line = t->line;
+    error_col = t->col;
 
     printf("   [Token] Code=%-2d Val=\"%-4s\" -> 识别为: %c\n",
            current_code, lexeme, sym);
@@ -250,10 +360,9 @@ const char* classify_error() {
     return "其他语法错误";
 }
 
-// 单行分析入口
+// 单行分析入口：buffer 与 stmt 已准备好
 void analyze_line(int line_num) {
-    pos = 0;
-    
+
     // 先检查是否为空行，如果是则直接返回不输出
     int temp_pos = 0;
     while (buffer[temp_pos] != '\0' && 
@@ -296,6 +405,8 @@ void analyze_line(int line_num) {
         for (int i = 0; i < error_pos; i++)
             printf(" ");
         printf("^~~~~~~\n");
+        if (error_line)
+            printf("\033[31m源程序位置: \033[0m第 %u 行第 %u 列\n", error_line, error_col);
 
         printf("\033[31m错误原因: \033[0m%s\n", classify_error());
         printf("----------------------------------------------------\n");
@@ -306,50 +417,144 @@ void analyze_line(int line_num) {
     printf("\n");
 }
 
-// 自动拆分并逐句分析
-void split_and_analyze(const char* bigbuf) {
+// 二元序列文本：边读边拆 token，读到分号 token 即分析本句，之后只保留下一句。
+// 内存与输入大小无关，整个输入只读一遍
+void split_and_analyze_text(FILE *fp, int stop_at_end) {
+    TextIn in = {0};
     int line_num = 1;
-    const char* p = bigbuf;
 
-    // 跳过开头的空白字符
-    while (*p && (isspace(*p) || *p == ',')) {
-        p++;
+    in.fp = fp;
+    in.stop_at_end = stop_at_end;
+    in.bol = 1;
+    text_next(&in);
+
+    while (1) {
+        // 跳过句子之间的空白字符，不计入显示文本
+        while (in.ch != EOF && (isspace(in.ch) || in.ch == ',')) text_next(&in);
+        if (in.ch == EOF) break;
+
+        int len = 0;
+        stmt_len = 0;
+        stmt_pos = 0;
+        buffer[0] = '\0';
+
+        while (1) {
+            StmtToken *t = stmt_slot();
+            if (!scan_text_token(&in, &len, t)) break;     // 最后一句可能没有分号
+            stmt_len++;
+            if (t->code == SYM_SEMICOLON) break;
+        }
+
+        analyze_line(line_num++);
     }
+}
 
-    while (*p) {
-        const char* end = strstr(p, "(17,\";\")");
+// 追加显示文本，超出 buffer 时截断
+void append_text(int *len, const char *text) {
+    int n = snprintf(buffer + *len, MAX_BUF - *len, "%s", text);
+    *len += n;
+    if (*len > MAX_BUF - 1) *len = MAX_BUF - 1;
+}
 
-        if (end == NULL) {
-            // 最后一段（可能没有分号）
-            // 检查是否为空或只包含空白字符
-            int has_content = 0;
-            for (const char* check = p; *check; check++) {
-                if (!isspace(*check) && *check != ',') {
-                    has_content = 1;
-                    break;
-                }
-            }
-            if (has_content) {
-                strcpy(buffer, p);
-                analyze_line(line_num++);
+// 本句追加一个已分好的 token；buffer 中按二元序列格式拼出本句，仅用于显示
+void add_stmt_token(int *len, int code, const char *text, unsigned id, pl0_loc loc) {
+    StmtToken *t = stmt_slot();
+    stmt_len++;
+    t->code = code;
+    t->id = id;
+    t->line = PL0_LINE(loc);
+    t->col = PL0_COL(loc);
+    t->sym = map_sym(code);
+    strncpy(t->lexeme, text, sizeof(t->lexeme) - 1);
+    t->lexeme[sizeof(t->lexeme) - 1] = '\0';
+    t->start = *len;
+    t->quiet = 0;
+
+    char head[32];
+    snprintf(head, sizeof(head), "%s(%d,\"", *len ? " " : "", code);
+    append_text(len, head);
+    append_text(len, text);
+    append_text(len, "\")");
+}
+
+// 二进制 token 流：按 (17,";") 逐句拆分，直接填入 stmt，无需解析文本
+void split_and_analyze_bin(const tokbin *tb) {
+    int line_num = 1;
+    uint32_t i = 0;
+
+    while (i < tb->ntokens) {
+        int len = 0;
+        stmt_len = 0;
+        stmt_pos = 0;
+        buffer[0] = '\0';
+
+        for (; i < tb->ntokens; i++) {
+            int code = tb->recs[i].kind;
+            add_stmt_token(&len, code, tokbin_text(tb, i), tb->recs[i].id, tb->recs[i].loc);
+            if (code == SYM_SEMICOLON) {
+                i++;
+                break;
             }
-            break;
         }
 
-        // 拆出一句（包含分号 token）
-        int len = end - p + strlen("(17,\";\")");
-        strncpy(buffer, p, len);
-        buffer[len] = '\0';
+        analyze_line(line_num++);
+    }
+}
+
+// 压缩 token 流：同上，但边解码边分析，每次只保留当前一句。格式错误返回 -1
+int split_and_analyze_var(tokvar_reader *tr) {
+    int line_num = 1;
+    tokvar_token tok;
+    int ret = tokvar_next(tr, &tok);
+
+    while (ret == 1) {
+        int len = 0;
+        stmt_len = 0;
+        stmt_pos = 0;
+        buffer[0] = '\0';
+
+        for (; ret == 1; ret = tokvar_next(tr, &tok)) {
+            add_stmt_token(&len, tok.kind, tok.text, tok.id, tok.loc);
+            if (tok.kind == SYM_SEMICOLON) {
+                ret = tokvar_next(tr, &tok);
+                break;
+            }
+        }
 
         analyze_line(line_num++);
+    }
+    return ret;
+}
 
-        p = end + strlen("(17,\";\")");  // 前进到下一句开始
-        
-        // 跳过空白字符，避免处理空内容
-        while (*p && (isspace(*p) || *p == ',')) {
-            p++;
+// 源程序：直接调用词法分析器，经向前看缓冲逐个取 token（缓冲区按批补充），
+// 凑满一句即分析，不格式化、不再解析文本。读取出错返回 -1
+int split_and_analyze_src(pl0_look *la) {
+    int line_num = 1;
+    int len = 0;
+    const pl0_token *t;
+
+    stmt_len = 0;
+    stmt_pos = 0;
+    buffer[0] = '\0';
+    while ((t = pl0_look_peek(la, 0))->sym != SYM_NULL) {
+        // 词素不一定以 '\0' 结尾，按长度拷贝（过长的截断，与 lexeme 的容量一致）
+        char text[sizeof(stmt[0].lexeme)];
+        size_t tl = t->len < sizeof(text) - 1 ? t->len : sizeof(text) - 1;
+        memcpy(text, t->text, tl);
+        text[tl] = '\0';
+        add_stmt_token(&len, t->sym, text, t->id, t->loc);
+
+        if (t->sym == SYM_SEMICOLON) {
+            analyze_line(line_num++);
+            len = 0;
+            stmt_len = 0;
+            stmt_pos = 0;
+            buffer[0] = '\0';
         }
+        pl0_look_consume(la);
     }
+    if (stmt_len) analyze_line(line_num++);     // 最后一句可能没有分号
+    return pl0_look_error(la) ? -1 : 0;
 }
 
 // --- 5. 主程序 ---
@@ -361,48 +566,83 @@ int main() {
     printf("=== 递归下降语法分析程序 (多句独立分析) ===\n");
     printf("1. 终端输入\n");
     printf("2. 文件读取\n");
+    printf("3. 源程序分析（直接调用词法分析器）\n");
     printf("选择: ");
     scanf("%d", &choice);
     getchar();
 
-    char bigbuf[MAX_BUF];
-    bigbuf[0] = '\0';
-
     if (choice == 1) {
         printf("请输入多行二元序列，输入 END 结束：\n");
+        split_and_analyze_text(stdin, 1);
+    }
+    else if (choice == 3) {
+        printf("源程序: ");
+        scanf("%s", filename);
 
-        char line[256];
-        while (1) {
-            if (fgets(line, sizeof(line), stdin) == NULL) break;
-            line[strcspn(line, "\n")] = 0;
-
-            if (strcmp(line, "END") == 0) break;
-
-            strcat(bigbuf, line);
-            strcat(bigbuf, " ");
+        pl0_lexer *lx = pl0_lexer_open(filename);
+        intern_table syms;
+        if (!lx || intern_init(&syms) != 0) {
+            printf("无法打开文件。\n");
+            if (lx) pl0_lexer_close(lx);
+            return 1;
         }
+        pl0_lexer_set_intern(lx, &syms);
+        pl0_look *la = pl0_look_open(lx, 1);
+        int ret = la ? split_and_analyze_src(la) : -1;
+        pl0_look_close(la);
+        pl0_lexer_close(lx);
+        intern_free(&syms);
+        if (ret != 0) {
+            printf("读取源程序出错。\n");
+            return 1;
+        }
+        printf("\n");
+        return 0;
     }
     else if (choice == 2) {
         printf("文件名: ");
         scanf("%s", filename);
 
-        fp = fopen(filename, "r");
+        fp = fopen(filename, "rb");
         if (!fp) {
             printf("无法打开文件。\n");
             return 1;
         }
 
-        char line[256];
-        while (fgets(line, sizeof(line), fp) != NULL) {
-            line[strcspn(line, "\n")] = 0;
-            strcat(bigbuf, line);
-            strcat(bigbuf, " ");
+        // 二进制 / 压缩 token 流直接按 token 分析
+        int c = fgetc(fp);
+        ungetc(c, fp);
+        if (c == (unsigned char)TOKVAR_MAGIC[0]) {
+            tokvar_reader tr;
+            int ret = tokvar_open(&tr, fp);
+            if (ret == 0) ret = split_and_analyze_var(&tr);
+            tokvar_close(&tr);
+            fclose(fp);
+            if (ret != 0) {
+                printf("压缩 token 流格式错误。\n");
+                return 1;
+            }
+            printf("\n");
+            return 0;
         }
+        if (c == TOKBIN_MAGIC[0]) {
+            tokbin tb;
+            if (tokbin_read(fp, &tb) != 0) {
+                printf("二进制 token 流格式错误。\n");
+                fclose(fp);
+                return 1;
+            }
+            fclose(fp);
+            split_and_analyze_bin(&tb);
+            tokbin_free(&tb);
+            printf("\n");
+            return 0;
+        }
+
+        split_and_analyze_text(fp, 0);
         fclose(fp);
     }
 
-    // ---- 调用封装好的函数 ----
-    split_and_analyze(bigbuf);
     printf("\n");
 
     return 0;
@@ -3,6 +3,14 @@
 #include <ctype.h>
 #include <string.h>
 
+// 二进制 / 压缩 token 流读取，以及直接调用词法分析器分析源程序，编译:
+//     gcc -O2 -pthread main.c ../Lab1/tokbin.c ../Lab1/tokvar.c ../Lab1/pl0lex.c ../Lab1/lex_simd.c ../Lab1/intern.c -o main
+// 用法: main [源程序]   不给源程序时从标准输入读二元序列或 token 流
+#include "../Lab1/tokbin.h"
+#include "../Lab1/tokvar.h"
+#define PL0LEX_NO_SYM // 本文件的 SYM_* 是文法符号，不用 pl0_sym.h 中的种别码
+#include "../Lab1/pl0lex.h"
+
 // --- 1. 定义符号与数据结构 ---
 // 终结符: i, +, *, (, ), #
 typedef enum
@@ -46,6 +54,9 @@ typedef struct
 {
     Terminal type;     // 映射后的文法符号
     int original_code; // 原始种别码 (如 1, 5, 17)
+    unsigned id;       // 符号 ID (仅二进制输入, 相同标识符 ID 相同), 0 表示无
+    unsigned line;     // 源程序中的行、列 (仅二进制输入), 0 表示未知
+    unsigned col;
     char value[50];    // 属性值 (如 "x", "*")
 } Token;
 
@@ -56,6 +67,7 @@ int LL1Table[VN_NUM][VT_NUM];                            // 预测分析表
 Production rules[10];                                    // 产生式集合
 const char *vt_names[] = {"i", "+", "*", "(", ")", "#"}; // 终结符集合
 const char *vn_names[] = {"E", "E'", "T", "T'", "F"};    // 非终结符集合
+const char *src_path = NULL;                             // 源程序路径，NULL 表示从标准输入读二元序列
 
 // --- 2. 初始化文法与分析表 ---
 // 终结符
@@ -173,9 +185,174 @@ Terminal identify_terminal(const char *value_str, int code)
     return SYM_i;
 }
 
+// 二进制 token 流带有种别码，直接按种别码判断，不必比较字符串
+Terminal identify_terminal_code(int code, const char *value_str)
+{
+    switch (code)
+    {
+    case 3: // +
+        return SYM_PLUS;
+    case 5: // *
+        return SYM_STAR;
+    case 13: // (
+        return SYM_LPAREN;
+    case 14: // )
+        return SYM_RPAREN;
+    case 17: // 将分号 ; 视为结束符 #
+        return SYM_EOF;
+    case 100: // 非法字符 #
+        if (value_str[0] == '#' && value_str[1] == '\0')
+            return SYM_EOF;
+        break;
+    }
+
+    // 其他情况视为标识符 i
+    return SYM_i;
+}
+
+// 读取二进制 token 流（lexer_manual -b 的输出），无需逐行解析文本
+int read_sequence_bin(Token *tokens)
+{
+    tokbin tb;
+    if (tokbin_read(stdin, &tb) != 0)
+    {
+        fprintf(stderr, "二进制 token 流格式错误\n");
+        return -1;
+    }
+
+    int count = 0;
+    for (uint32_t i = 0; i < tb.ntokens && count < 99; i++)
+    {
+        const char *value = tokbin_text(&tb, i);
+        tokens[count].type = identify_terminal_code(tb.recs[i].kind, value); // 识别终结符
+        tokens[count].original_code = tb.recs[i].kind;                    // 存储种别码
+        tokens[count].id = tb.recs[i].id;                                 // 存储符号 ID
+        tokens[count].line = PL0_LINE(tb.recs[i].loc);                    // 存储源程序位置
+        tokens[count].col = PL0_COL(tb.recs[i].loc);
+        strncpy(tokens[count].value, value, sizeof(tokens[0].value) - 1); // 存储属性值
+        tokens[count].value[sizeof(tokens[0].value) - 1] = '\0';
+        count++;
+    }
+    tokbin_free(&tb);
+
+    // 自动添加结束标记
+    tokens[count].type = SYM_EOF;
+    tokens[count].original_code = -1;
+    tokens[count].id = 0;
+    tokens[count].line = tokens[count].col = 0;
+    strcpy(tokens[count].value, "#");
+    return count + 1;
+}
+
+// 读取压缩 token 流（lexer_manual -z 的输出），边解码边存入
+int read_sequence_var(Token *tokens)
+{
+    tokvar_reader tr;
+    tokvar_token t;
+    if (tokvar_open(&tr, stdin) != 0)
+    {
+        fprintf(stderr, "压缩 token 流格式错误\n");
+        return -1;
+    }
+
+    int count = 0;
+    int ret;
+    while (count < 99 && (ret = tokvar_next(&tr, &t)) == 1)
+    {
+        tokens[count].type = identify_terminal_code(t.kind, t.text);       // 识别终结符
+        tokens[count].original_code = t.kind;                              // 存储种别码
+        tokens[count].id = t.id;                                           // 存储符号 ID
+        tokens[count].line = PL0_LINE(t.loc);                              // 存储源程序位置
+        tokens[count].col = PL0_COL(t.loc);
+        strncpy(tokens[count].value, t.text, sizeof(tokens[0].value) - 1); // 存储属性值
+        tokens[count].value[sizeof(tokens[0].value) - 1] = '\0';
+        count++;
+    }
+    tokvar_close(&tr);
+    if (count < 99 && ret < 0)
+    {
+        fprintf(stderr, "压缩 token 流格式错误\n");
+        return -1;
+    }
+
+    // 自动添加结束标记
+    tokens[count].type = SYM_EOF;
+    tokens[count].original_code = -1;
+    tokens[count].id = 0;
+    tokens[count].line = tokens[count].col = 0;
+    strcpy(tokens[count].value, "#");
+    return count + 1;
+}
+
+// 直接调用词法分析器分析源程序，按需逐批取 token，不经过文本。
+// 分号即结束符 #，分析到第一个分号为止，之后的源程序不再分析
+int read_sequence_src(Token *tokens)
+{
+    pl0_lexer *lx = pl0_lexer_open(src_path);
+    intern_table syms;
+    if (!lx || intern_init(&syms) != 0)
+    {
+        fprintf(stderr, "无法打开源程序: %s\n", src_path);
+        if (lx)
+            pl0_lexer_close(lx);
+        return -1;
+    }
+    pl0_lexer_set_intern(lx, &syms);
+
+    int count = 0;
+    int stop = 0;
+    pl0_token toks[16];
+    size_t n;
+    while (!stop && (n = pl0_lex_batch(lx, toks, 16)) > 0)
+    {
+        for (size_t i = 0; i < n && !stop; i++)
+        {
+            // 词素不一定以 '\0' 结尾，按长度拷贝
+            size_t len = toks[i].len < sizeof(tokens[0].value) - 1 ? toks[i].len : sizeof(tokens[0].value) - 1;
+            memcpy(tokens[count].value, toks[i].text, len);
+            tokens[count].value[len] = '\0';
+            tokens[count].type = identify_terminal_code(toks[i].sym, tokens[count].value); // 识别终结符
+            tokens[count].original_code = toks[i].sym;                                     // 存储种别码
+            tokens[count].id = toks[i].id;                                                 // 存储符号 ID
+            tokens[count].line = PL0_LINE(toks[i].loc);                                    // 存储源程序位置
+            tokens[count].col = PL0_COL(toks[i].loc);
+            stop = tokens[count++].type == SYM_EOF || count >= 99;
+        }
+    }
+    int err = pl0_lexer_error(lx);
+    pl0_lexer_close(lx);
+    intern_free(&syms);
+    if (err)
+    {
+        fprintf(stderr, "读取源程序出错: %s\n", src_path);
+        return -1;
+    }
+
+    // 自动添加结束标记
+    tokens[count].type = SYM_EOF;
+    tokens[count].original_code = -1;
+    tokens[count].id = 0;
+    tokens[count].line = tokens[count].col = 0;
+    strcpy(tokens[count].value, "#");
+    return count + 1;
+}
+
 // 读取输入序列
 int read_sequence(Token *tokens)
 {
+    if (src_path)
+        return read_sequence_src(tokens);
+
+    // 以 TOKBIN_MAGIC / TOKVAR_MAGIC 开头的输入按二进制 / 压缩 token 流读取；
+    // 其余输入（包括空输入）仍按文本读取
+    int c = getc(stdin);
+    if (c != EOF)
+        ungetc(c, stdin);
+    if (c == (unsigned char)TOKBIN_MAGIC[0])
+        return read_sequence_bin(tokens);
+    if (c == (unsigned char)TOKVAR_MAGIC[0])
+        return read_sequence_var(tokens);
+
     int count = 0;  // 存储token数量
     char line[256]; // 存储输入行
 
@@ -207,6 +384,8 @@ int read_sequence(Token *tokens)
         // 存储token
         tokens[count].type = identify_terminal(value, code);              // 识别终结符-
         tokens[count].original_code = code;                               // 存储种别码
+        tokens[count].id = 0;                                             // 文本输入没有符号 ID
+        tokens[count].line = tokens[count].col = 0;                       // 也没有源程序位置
         strncpy(tokens[count].value, value, sizeof(tokens[0].value) - 1); // 存储属性值
         tokens[count].value[sizeof(tokens[0].value) - 1] = '\0';          // 确保字符串结束
         count++;                                                          // 增加token数量
@@ -215,6 +394,8 @@ int read_sequence(Token *tokens)
     // 自动添加结束标记
     tokens[count].type = SYM_EOF;     // 设置终结符
     tokens[count].original_code = -1; // 设置种别码
+    tokens[count].id = 0;
+    tokens[count].line = tokens[count].col = 0;
     strcpy(tokens[count].value, "#"); // 设置属性值
     return count + 1;                 // 返回token数量
 }
@@ -323,16 +504,25 @@ void parse_LL1()
     if (success)
         printf("\033[32m结论: 输入串是该文法定义的算术表达式\033[0m\n\n");
     else
+    {
+        if (tokens[ip].line)
+            printf("\033[31m错误位置: 源程序第 %u 行第 %u 列\033[0m\n", tokens[ip].line, tokens[ip].col);
         printf("\033[31m结论: 输入串不是该文法定义的算术表达式\033[0m\n\n");
+    }
 }
 
 // --- 5. 主函数 ---
-int main()
+int main(int argc, char *argv[])
 {
     init_grammar();
+    if (argc > 1)
+        src_path = argv[1];
 
     printf("=============== LL(1) 分析器 ===============\n");
-    printf("请输入多行二元序列，输入 END 结束：\n");
+    if (src_path)
+        printf("源程序: %s\n", src_path);
+    else
+        printf("请输入多行二元序列，输入 END 结束：\n");
 
     parse_LL1();
 